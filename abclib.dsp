@@ -4971,6 +4971,14 @@ SOURCE=.\src\misc\util\utilIsop.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilJson.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilJson.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilMem.c
 # End Source File
 # Begin Source File
@@ -195,6 +195,11 @@ struct Gia_Man_t_
     void *         pLutLib;       // LUT library
     word           nHashHit;      // hash table hit
     word           nHashMiss;     // hash table miss
+    word           nHashLookup;   // hash table lookups
+    word           nHashProbe;    // hash table entries compared during lookups
+    int            nHashProbeMax; // hash table entries compared in the longest lookup
+    int            nHashResize;   // hash table resizes
+    abctime        timeHash;      // hash table time spent in rehashing the nodes
     void *         pData;         // various user data
     unsigned *     pData2;        // various user data
     int            iData;         // various user data
@@ -1273,8 +1278,9 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
-extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadMapped( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int * pfMapped );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
@@ -1283,7 +1289,9 @@ extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_I
 extern void                Gia_AigerWriteSimple( Gia_Man_t * pInit, char * pFileName );
 /*=== giaBalance.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVerbose );
+extern Gia_Man_t *         Gia_ManBalancePar( Gia_Man_t * p, int fSimpleAnd, int fStrict, int nProcs, int fVerbose );
 extern Gia_Man_t *         Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int fVerbose, int fVeryVerbose );
+extern Gia_Man_t *         Gia_ManAreaBalancePar( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int nProcs, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManAigSyn2( Gia_Man_t * p, int fOldAlgo, int fCoarsen, int fCutMin, int nRelaxRatio, int fDelayMin, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManAigSyn3( Gia_Man_t * p, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManAigSyn4( Gia_Man_t * p, int fVerbose, int fVeryVerbose );
@@ -1512,9 +1520,22 @@ extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashDualMiter( Gia_Man_t * p, Vec_Int_t * vOuts );
+extern void                Gia_ManHashStatsAdd( Gia_Man_t * p );
+extern void                Gia_ManHashStatsReset();
+extern void                Gia_ManHashStatsPrint( Gia_Man_t * p );
+/*=== giaHashPar.c ===========================================================*/
+typedef struct Gia_HashPar_t_ Gia_HashPar_t;
+extern Gia_HashPar_t *     Gia_HashParStart( Gia_Man_t * pGia, int nNodesMax, int nThreads );
+extern void                Gia_HashParStop( Gia_HashPar_t * p );
+extern int                 Gia_HashParAnd( Gia_HashPar_t * p, int iThread, int iLit0, int iLit1 );
+extern int                 Gia_HashParLit( Gia_HashPar_t * p, int iLit );
+extern void                Gia_HashParTransfer( Gia_HashPar_t * p, Vec_Int_t * vLits );
+extern void                Gia_HashParPrintStats( Gia_HashPar_t * p );
+extern Gia_Man_t *         Gia_ManRehashPar( Gia_Man_t * p, int nThreads, int fVerbose );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintOutputLutStats( Gia_Man_t * p );
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
+extern void                Gia_ManPrintMappingStatsJson( Gia_Man_t * p, void * pJson );
 extern void                Gia_ManPrintPackingStats( Gia_Man_t * p );
 extern void                Gia_ManPrintLutStats( Gia_Man_t * p );
 extern int                 Gia_ManLutFaninCount( Gia_Man_t * p );
@@ -1554,6 +1575,7 @@ extern void                Gia_ManStop( Gia_Man_t * p );
 extern void                Gia_ManStopP( Gia_Man_t ** p );  
 extern double              Gia_ManMemory( Gia_Man_t * p );
 extern void                Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars ); 
+extern void                Gia_ManPrintStatsJson( Gia_Man_t * p, Gps_Par_t * pPars, void * pJson );
 extern void                Gia_ManPrintStatsShort( Gia_Man_t * p ); 
 extern void                Gia_ManPrintMiterStatus( Gia_Man_t * p ); 
 extern void                Gia_ManPrintStatsMiter( Gia_Man_t * p, int fVerbose );
@@ -19,9 +19,20 @@
 
 ***********************************************************************/
 
+#include <limits.h>
+#include <stdarg.h>
 #include "gia.h"
 #include "misc/tim/tim.h"
+#include "misc/zlib/zlib.h"
+#include "misc/bzlib/bzlib.h"
 #include "base/main/main.h"
+#include <sys/stat.h>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,6 +42,21 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_AIGER_OUT_SIZE  (1 << 16)
+#define GIA_AIGER_GZ_RATIO  16        // the largest expansion of gzip trusted when sizing the buffer
+
+// the output file of the AIGER writer (compressed if the name ends with .gz or .bz2)
+typedef struct Gia_AigerOut_t_ Gia_AigerOut_t;
+struct Gia_AigerOut_t_
+{
+    FILE *       pFile;        // the output file (also used by bzlib)
+    gzFile       pGz;          // the file compressed by zlib
+    BZFILE *     pBz;          // the file compressed by bzlib
+    int          fError;       // writing has failed
+    int          nBuffer;      // the number of bytes in the buffer
+    unsigned char pBuffer[GIA_AIGER_OUT_SIZE]; // the fixed-size output buffer
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -82,6 +108,140 @@ void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
     Gia_AigerWriteInt( Buffer, nSize );
     fwrite( Buffer, 1, 4, pFile );
 }
+int Gia_FileHasExt( char * pFileName, char * pExt )
+{
+    int nName = strlen(pFileName), nExt = strlen(pExt);
+    return nName > nExt && !strcmp( pFileName + nName - nExt, pExt );
+}
+int Gia_FileIsCompressed( char * pFileName )
+{
+    return Gia_FileHasExt( pFileName, ".gz" ) || Gia_FileHasExt( pFileName, ".bz2" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Opens the output file of the AIGER writer.]
+
+  Description [The file is compressed by zlib or bzlib if its name ends 
+  with .gz or .bz2, respectively. The data is collected in the buffer of 
+  a fixed size, which is flushed into the file when it is full, so the 
+  memory used by the writer does not depend on the size of the AIG. 
+  Returns NULL if the file cannot be opened.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_AigerOut_t * Gia_AigerOutOpen( char * pFileName )
+{
+    Gia_AigerOut_t * p = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    int bzError;
+    if ( Gia_FileHasExt(pFileName, ".gz") )
+        p->pGz = gzopen( pFileName, "wb" );
+    else if ( (p->pFile = fopen( pFileName, "wb" )) && Gia_FileHasExt(pFileName, ".bz2") )
+    {
+        p->pBz = BZ2_bzWriteOpen( &bzError, p->pFile, 9, 0, 0 );
+        if ( bzError != BZ_OK )
+        {
+            BZ2_bzWriteClose( &bzError, p->pBz, 1, NULL, NULL );
+            fclose( p->pFile );
+            p->pFile = NULL;
+            p->pBz = NULL;
+        }
+    }
+    if ( p->pFile == NULL && p->pGz == NULL )
+        ABC_FREE( p );
+    return p;
+}
+void Gia_AigerOutWriteRaw( Gia_AigerOut_t * p, void * pData, int nBytes )
+{
+    int bzError;
+    if ( nBytes <= 0 || p->fError )
+        return;
+    if ( p->pGz )
+        p->fError = gzwrite( p->pGz, pData, (unsigned)nBytes ) != nBytes;
+    else if ( p->pBz )
+    {
+        BZ2_bzWrite( &bzError, p->pBz, pData, nBytes );
+        p->fError = bzError != BZ_OK;
+    }
+    else
+        p->fError = fwrite( pData, 1, nBytes, p->pFile ) != (size_t)nBytes;
+}
+void Gia_AigerOutFlush( Gia_AigerOut_t * p )
+{
+    Gia_AigerOutWriteRaw( p, p->pBuffer, p->nBuffer );
+    p->nBuffer = 0;
+}
+void Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pData, int nBytes )
+{
+    if ( p->nBuffer + nBytes > GIA_AIGER_OUT_SIZE )
+        Gia_AigerOutFlush( p );
+    if ( nBytes >= GIA_AIGER_OUT_SIZE )
+        Gia_AigerOutWriteRaw( p, pData, nBytes );
+    else if ( nBytes > 0 )
+    {
+        memcpy( p->pBuffer + p->nBuffer, pData, (size_t)nBytes );
+        p->nBuffer += nBytes;
+    }
+}
+static inline void Gia_AigerOutWriteUnsigned( Gia_AigerOut_t * p, unsigned x )
+{
+    if ( p->nBuffer + 5 > GIA_AIGER_OUT_SIZE )
+        Gia_AigerOutFlush( p );
+    p->nBuffer = Gia_AigerWriteUnsignedBuffer( p->pBuffer, p->nBuffer, x );
+}
+static inline int Gia_AigerOutWriteLiteral( Gia_AigerOut_t * p, int LitPrev, int Lit )
+{
+    if ( LitPrev == -1 )
+        Gia_AigerOutWriteUnsigned( p, Lit );
+    else
+        Gia_AigerOutWriteUnsigned( p, (Abc_AbsInt(Lit - LitPrev) << 1) | (int)(Lit < LitPrev) );
+    return Lit;
+}
+void Gia_AigerOutWriteSize( Gia_AigerOut_t * p, int nSize )
+{
+    unsigned char Buffer[5];
+    Gia_AigerWriteInt( Buffer, nSize );
+    Gia_AigerOutWrite( p, Buffer, 4 );
+}
+void Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pBuffer = Buffer;
+    int nBytes;
+    va_list args;
+    va_start( args, pFormat );
+    nBytes = vsnprintf( Buffer, sizeof(Buffer), pFormat, args );
+    va_end( args );
+    if ( nBytes >= (int)sizeof(Buffer) )
+    {
+        pBuffer = ABC_ALLOC( char, nBytes + 1 );
+        va_start( args, pFormat );
+        vsnprintf( pBuffer, nBytes + 1, pFormat, args );
+        va_end( args );
+    }
+    Gia_AigerOutWrite( p, pBuffer, nBytes );
+    if ( pBuffer != Buffer )
+        ABC_FREE( pBuffer );
+}
+int Gia_AigerOutClose( Gia_AigerOut_t * p )
+{
+    int bzError, RetValue;
+    Gia_AigerOutFlush( p );
+    RetValue = !p->fError;
+    if ( p->pGz )
+        RetValue &= (gzclose( p->pGz ) == Z_OK);
+    if ( p->pBz )
+    {
+        BZ2_bzWriteClose( &bzError, p->pBz, p->fError, NULL, NULL );
+        RetValue &= (bzError == BZ_OK);
+    }
+    if ( p->pFile )
+        RetValue &= (fclose( p->pFile ) == 0);
+    ABC_FREE( p );
+    return RetValue;
+}
 
 /**Function*************************************************************
 
@@ -173,7 +333,7 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
@@ -522,9 +682,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         if ( fBreakUsed )
         {
             unsigned char * pName;
-            int Entry, nInvars, nConstr, iTerm;
+            int nInvars, nConstr, iTerm;
 
-            Vec_Int_t * vPoNames = Vec_IntStartFull( nOutputs );
+            Vec_Ptr_t * vPoNames = Vec_PtrStart( nOutputs );
 
             Vec_IntFreeP( &pNew->vUserPiIds );
             Vec_IntFreeP( &pNew->vUserPoIds );
@@ -558,7 +718,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                     fBreakUsed = 1;
                     break;
                 }
-                if ( Vec_IntEntry(vPoNames, iTerm) != ~0 )
+                if ( Vec_PtrEntry(vPoNames, iTerm) != NULL )
                 {
                     fprintf( stdout, "The output number (%d) is listed twice.\n", iTerm );
                     fBreakUsed = 1;
@@ -569,7 +729,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 pName = pCur;          while ( *pCur++ != '\n' );
                 *(pCur-1) = 0;
                 // assign the name
-                Vec_IntWriteEntry( vPoNames, iTerm, pName - (unsigned char *)pContents );
+                Vec_PtrWriteEntry( vPoNames, iTerm, pName );
             } 
 
             // check that all names are assigned
@@ -577,16 +737,16 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             {
                 nInvars = nConstr = 0;
                 vPoTypes = Vec_IntStart( Gia_ManPoNum(pNew) );
-                Vec_IntForEachEntry( vPoNames, Entry, i )
+                Vec_PtrForEachEntry( unsigned char *, vPoNames, pName, i )
                 {
-                    if ( Entry == ~0 )
+                    if ( pName == NULL )
                         continue;
-                    if ( strncmp( pContents+Entry, "constraint:", 11 ) == 0 )
+                    if ( strncmp( (char *)pName, "constraint:", 11 ) == 0 )
                     {
                         Vec_IntWriteEntry( vPoTypes, i, 1 );
                         nConstr++;
                     }
-                    if ( strncmp( pContents+Entry, "invariant:", 10 ) == 0 )
+                    if ( strncmp( (char *)pName, "invariant:", 10 ) == 0 )
                     {
                         Vec_IntWriteEntry( vPoTypes, i, 2 );
                         nInvars++;
@@ -599,7 +759,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 if ( nConstr == 0 && nInvars == 0 )
                     Vec_IntFreeP( &vPoTypes );
             }
-            Vec_IntFree( vPoNames );
+            Vec_PtrFree( vPoNames );
         }
         }
     }
@@ -1003,11 +1163,154 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reads the contents of the compressed AIGER file.]
+
+  Description [The file is decompressed by zlib or bzlib depending on 
+  whether its name ends with .gz or .bz2. The data is inflated directly 
+  into the buffer passed to the parser, which grows as the data arrives. 
+  For the gzip files, the length stored in the gzip trailer is used as a 
+  hint for the initial size, but it is not trusted beyond a small multiple 
+  of the compressed size, because the trailer may be wrong or corrupted. 
+  Returns NULL if the file cannot be read.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_AigerReadCompressed( char * pFileName, size_t * pnFileSize )
+{
+    char * pContents = NULL;
+    size_t nAlloc = 1 << 16, nSize = 0;
+    long nRead;
+    *pnFileSize = 0;
+    if ( Gia_FileHasExt(pFileName, ".gz") )
+    {
+        unsigned char Trailer[4];
+        gzFile pGz;
+        long nCompr;
+        FILE * pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        // the last four bytes of a gzip file contain the uncompressed size modulo 2^32
+        if ( fseek( pFile, 0, SEEK_END ) == 0 && (nCompr = ftell( pFile )) >= 4 &&
+             fseek( pFile, -4, SEEK_END ) == 0 && fread( Trailer, 1, 4, pFile ) == 4 )
+        {
+            size_t nHint = (size_t)((unsigned)Trailer[0] | ((unsigned)Trailer[1] << 8) | ((unsigned)Trailer[2] << 16) | ((unsigned)Trailer[3] << 24));
+            nHint = Abc_MinWord( nHint, (word)nCompr * GIA_AIGER_GZ_RATIO );
+            if ( nAlloc < nHint + 1 )
+                nAlloc = nHint + 1;
+        }
+        fclose( pFile );
+        pGz = gzopen( pFileName, "rb" );
+        if ( pGz == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nAlloc );
+        while ( (nRead = gzread( pGz, pContents + nSize, (unsigned)Abc_MinWord(nAlloc - nSize, 1 << 30) )) > 0 )
+        {
+            nSize += nRead;
+            if ( nSize == nAlloc )
+                pContents = ABC_REALLOC( char, pContents, (nAlloc *= 2) );
+        }
+        if ( gzclose( pGz ) != Z_OK || nRead < 0 )
+            ABC_FREE( pContents );
+    }
+    else
+    {
+        BZFILE * pBz;
+        int bzError = BZ_OK;
+        FILE * pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pBz = BZ2_bzReadOpen( &bzError, pFile, 0, 0, NULL, 0 );
+        if ( bzError == BZ_OK )
+        {
+            pContents = ABC_ALLOC( char, nAlloc );
+            while ( bzError == BZ_OK )
+            {
+                nRead = BZ2_bzRead( &bzError, pBz, pContents + nSize, (int)Abc_MinWord(nAlloc - nSize, 1 << 30) );
+                if ( bzError != BZ_OK && bzError != BZ_STREAM_END )
+                    break;
+                if ( (nSize += nRead) == nAlloc )
+                    pContents = ABC_REALLOC( char, pContents, (nAlloc *= 2) );
+            }
+            if ( bzError != BZ_STREAM_END )
+                ABC_FREE( pContents );
+        }
+        BZ2_bzReadClose( &bzError, pBz );
+        fclose( pFile );
+    }
+    if ( pContents == NULL )
+        printf( "Gia_AigerRead(): Decompressing the file \"%s\" has failed.\n", pFileName );
+    else
+    {
+        pContents[nSize] = 0;
+        *pnFileSize = nSize;
+    }
+    return pContents;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG from the memory-mapped file.]
+
+  Description [Sets *pfMapped to 0 if the file could not be mapped and
+  has to be read by other means.  Similar to the buffer read by
+  Gia_AigerRead(), the mapping includes one byte after the end of the
+  file, which is 0 because the file does not end on a page boundary.
+  The files ending on a page boundary are not mapped.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadMapped( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int * pfMapped )
+{
+    Gia_Man_t * pNew = NULL;
+    *pfMapped = 0;
+#if !defined(_WIN32)
+    {
+        struct stat Stat;
+        char * pContents;
+        size_t nFileSize;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd == -1 )
+            return NULL;
+        if ( fstat( fd, &Stat ) == -1 || !S_ISREG(Stat.st_mode) || Stat.st_size == 0 || 
+             Stat.st_size % sysconf(_SC_PAGESIZE) == 0 )
+        {
+            close( fd );
+            return NULL;
+        }
+        nFileSize = (size_t)Stat.st_size;
+        // the parser writes into the buffer in a few places, so the mapping is 
+        // private: only the pages written to are copied, the rest are shared 
+        // with the page cache
+        pContents = (char *)mmap( NULL, nFileSize + 1, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+        close( fd );
+        if ( pContents == (char *)MAP_FAILED )
+            return NULL;
+        assert( pContents[nFileSize] == 0 );
+#ifdef MADV_SEQUENTIAL
+        madvise( pContents, nFileSize + 1, MADV_SEQUENTIAL );
+#endif
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        munmap( pContents, nFileSize + 1 );
+        *pfMapped = 1;
+    }
+#endif
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [Maps the file into memory when the platform supports it
+  and falls back on reading the file into a buffer otherwise.]
   
   SideEffects []
 
@@ -1019,23 +1322,57 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    size_t nFileSize;
+    int fMapped, RetValue;
 
-    // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    if ( Gia_FileIsCompressed( pFileName ) )
+    {
+        pContents = Gia_AigerReadCompressed( pFileName, &nFileSize );
+        if ( pContents == NULL )
+            return NULL;
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+        fMapped = 1;
+    }
+    else
+        pNew = Gia_AigerReadMapped( pFileName, fGiaSimple, fSkipStrash, fCheck, &fMapped );
+    if ( !fMapped )
+    {
+        // read the file into the 0-terminated buffer
+        struct stat Stat;
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL || stat( pFileName, &Stat ) == -1 )
+        {
+            printf( "Gia_AigerRead(): The file \"%s\" is unavailable (absent or open).\n", pFileName );
+            if ( pFile )
+                fclose( pFile );
+            return NULL;
+        }
+        nFileSize = (size_t)Stat.st_size;
+        pContents = ABC_ALLOC( char, nFileSize + 1 );
+        RetValue = fread( pContents, 1, nFileSize, pFile ) == nFileSize;
+        pContents[nFileSize] = 0;
+        fclose( pFile );
+        if ( !RetValue )
+        {
+            printf( "Gia_AigerRead(): Reading the file \"%s\" has failed.\n", pFileName );
+            ABC_FREE( pContents );
+            return NULL;
+        }
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
         pName = Gia_FileNameGeneric( pFileName );
+        if ( Gia_FileIsCompressed( pFileName ) )
+        {
+            char * pTemp = pName;
+            pName = Gia_FileNameGeneric( pTemp );
+            ABC_FREE( pTemp );
+        }
         pNew->pName = Abc_UtilStrsav( pName );
         ABC_FREE( pName );
 
@@ -1220,12 +1557,11 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
 {
     int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
+    Gia_AigerOut_t * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
+    int i, LitPrev = -1;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
@@ -1236,7 +1572,7 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     }
 
     // start the output stream
-    pFile = fopen( pFileName, "wb" );
+    pFile = Gia_AigerOutOpen( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
@@ -1257,7 +1593,7 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerOutPrintf( pFile, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1266,55 +1602,39 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerOutPrintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerOutPrintf( pFile, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
-        Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
-        Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
-        Vec_StrFree( vBinary );
-        Vec_IntFree( vLits );
+        // write latch and PO drivers (see Gia_AigerWriteLiterals)
+        Gia_ManForEachRi( p, pObj, i )
+            LitPrev = Gia_AigerOutWriteLiteral( pFile, LitPrev, Gia_ObjFaninLit0p(p, pObj) );
+        Gia_ManForEachPo( p, pObj, i )
+            LitPrev = Gia_AigerOutWriteLiteral( pFile, LitPrev, Gia_ObjFaninLit0p(p, pObj) );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    // write the nodes
     Gia_ManForEachAnd( p, pObj, i )
     {
         uLit  = Abc_Var2Lit( i, 0 );
         uLit0 = Gia_ObjFaninLit0( pObj, i );
         uLit1 = Gia_ObjFaninLit1( pObj, i );
         assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
+        Gia_AigerOutWriteUnsigned( pFile, uLit  - uLit1 );
+        Gia_AigerOutWriteUnsigned( pFile, uLit1 - uLit0 );
     }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1323,13 +1643,13 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerOutPrintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerOutPrintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerOutPrintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
     if ( p->vNamesNode && Vec_PtrSize(p->vNamesNode) != Gia_ManObjNum(p) )
         Abc_Print( 0, "The size of the node name array does not match the number of objects. Names are not written.\n" );
@@ -1337,38 +1657,38 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Gia_ManForEachAnd( p, pObj, i )
             if ( Vec_PtrEntry(p->vNamesNode, i) )
-                fprintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
+                Gia_AigerOutPrintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
     }
 
     // write the comment
     if ( fWriteNewLine ) 
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pFile, "c\n" );
     else
-        fprintf( pFile, "c" );
+        Gia_AigerOutPrintf( pFile, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerOutPrintf( pFile, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerOutPrintf( pFile, "c" );
+        Gia_AigerOutWriteSize( pFile, 4 );
+        Gia_AigerOutWriteSize( pFile, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerOutPrintf( pFile, "d" );
+        Gia_AigerOutWriteSize( pFile, 4 );
+        Gia_AigerOutWriteSize( pFile, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1376,18 +1696,18 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pFile, "i" );
+            Gia_AigerOutWriteSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pFile, pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pFile, "o" );
+            Gia_AigerOutWriteSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pFile, pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
         }
@@ -1396,35 +1716,35 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigerOutPrintf( pFile, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigerOutPrintf( pFile, "f" );
+        Gia_AigerOutWriteSize( pFile, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pFile, "g" );
+        Gia_AigerOutWriteSize( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerOutPrintf( pFile, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1432,10 +1752,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerOutPrintf( pFile, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1444,11 +1764,11 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigerOutPrintf( pFile, "w" );
+        Gia_AigerOutWriteSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigerOutWriteSize( pFile, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigerOutWriteSize( pFile, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1457,10 +1777,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerOutPrintf( pFile, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
@@ -1468,10 +1788,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( Gia_ManHasCellMapping(p) )
     {
         extern Vec_Str_t * Gia_AigerWriteCellMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "M" );
+        Gia_AigerOutPrintf( pFile, "M" );
         vStrExt = Gia_AigerWriteCellMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"M\".\n" );
 
@@ -1479,101 +1799,102 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pFile, "p" );
+        Gia_AigerOutWriteSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pFile, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerOutPrintf( pFile, "r" );
+        Gia_AigerOutWriteSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerOutWriteSize( pFile, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerOutWriteSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigerOutPrintf( pFile, "s" );
+        Gia_AigerOutWriteSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigerOutWriteSize( pFile, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigerOutWriteSize( pFile, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerOutPrintf( pFile, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
-//        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
+        Gia_AigerOutWriteSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pFile, p->pCellStr, strlen(p->pCellStr) + 1 );
+//        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vConfigs), 4*Vec_IntSize(p->vConfigs) );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigerOutWriteSize( pFile, Vec_IntEntry(p->vConfigs, i) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerOutPrintf( pFile, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerOutWriteSize( pFile, 4*(nPairs * 2 + 1) );
+        Gia_AigerOutWriteSize( pFile, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerOutWriteSize( pFile, i );
+                Gia_AigerOutWriteSize( pFile, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pFile, "u" );
+        Gia_AigerOutWriteSize( pFile, Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pFile, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigerOutPrintf( pFile, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pFile, "v" );
+        Gia_AigerOutWriteSize( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerOutPrintf( pFile, "n" );
+        Gia_AigerOutWriteSize( pFile, strlen(p->pName)+1 );
+        Gia_AigerOutWrite( pFile, p->pName, strlen(p->pName) );
+        Gia_AigerOutPrintf( pFile, "%c", '\0' );
     }
     // write comments
     if ( fWriteNewLine )
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pFile, "c\n" );
     if ( !fSkipComment ) {
-        fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-        fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+        Gia_AigerOutPrintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+        Gia_AigerOutPrintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
     }
-    fclose( pFile );
+    if ( !Gia_AigerOutClose( pFile ) )
+        fprintf( stdout, "Gia_AigerWrite(): Writing the output file \"%s\" has failed.\n", pFileName );
     if ( p != pInit )
     {
         Gia_ManTransferTiming( pInit, p );
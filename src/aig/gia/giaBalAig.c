@@ -43,6 +43,7 @@ struct Dam_Man_t_
     Vec_Int_t *      vNodLevR;  // node reverse level
     Vec_Int_t *      vDivLevR;  // divisor reverse level
     Vec_Int_t *      vVisit;    // visited MUXes
+    Vec_Wec_t *      vSupers;   // supergates collected concurrently
     Vec_Que_t *      vQue;      // pairs by their weight
     Hash_IntMan_t *  vHash;     // pair hash table
     abctime          clkStart;  // starting the clock
@@ -51,6 +52,21 @@ struct Dam_Man_t_
     int              nAnds;     // total AND node count
     int              nGain;     // total gain in AND nodes
     int              nGainX;    // gain from XOR nodes
+    int              nProcs;    // the number of threads to collect supergates
+};
+
+#define GIA_BAL_PAR_MIN  1000   // the smallest wavefront divided among the threads
+
+typedef struct Gia_BalPar_t_ Gia_BalPar_t;
+struct Gia_BalPar_t_
+{
+    Gia_Man_t *      p;         // user's AIG
+    Vec_Wec_t *      vSupers;   // supergates by object ID
+    Vec_Int_t *      vRoots;    // the roots of the current wavefront
+    Vec_Int_t *      vNext;     // the roots of the next wavefront
+    int              nPerThread;// the number of roots processed by one thread
+    int              nProcs;    // the number of threads
+    int              fStrict;   // strict area control
 };
 
 static inline int    Dam_ObjHand( Dam_Man_t * p, int i )     { return i < Vec_IntSize(p->vNod2Set) ? Vec_IntEntry(p->vNod2Set, i) : 0;                      }
@@ -125,68 +141,175 @@ void Gia_ManSimplifyAnd( Vec_Int_t * vSuper )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSuperCollectXor_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+void Gia_ManSuperCollectXor_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
 {
     assert( !Gia_IsComplement(pObj) );
     if ( !Gia_ObjIsXor(pObj) ||     
         (fStrict && Gia_ObjRefNum(p, pObj) > 1) || 
         Gia_ObjRefNum(p, pObj) > 2 || 
         (Gia_ObjRefNum(p, pObj) == 2 && (Gia_ObjRefNum(p, Gia_ObjFanin0(pObj)) == 1 || Gia_ObjRefNum(p, Gia_ObjFanin1(pObj)) == 1)) || 
-        Vec_IntSize(p->vSuper) > 50 )
+        Vec_IntSize(vSuper) > 50 )
     {
-        Vec_IntPush( p->vSuper, Gia_ObjToLit(p, pObj) );
+        Vec_IntPush( vSuper, Gia_ObjToLit(p, pObj) );
         return;
     }
     assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
-    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict );
-    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict );
+    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict, vSuper );
+    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict, vSuper );
 }
-void Gia_ManSuperCollectAnd_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+void Gia_ManSuperCollectAnd_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
 {
     if ( Gia_IsComplement(pObj) || 
         !Gia_ObjIsAndReal(p, pObj) || 
         (fStrict && Gia_ObjRefNum(p, pObj) > 1) || 
         Gia_ObjRefNum(p, pObj) > 2 || 
         (Gia_ObjRefNum(p, pObj) == 2 && (Gia_ObjRefNum(p, Gia_ObjFanin0(pObj)) == 1 || Gia_ObjRefNum(p, Gia_ObjFanin1(pObj)) == 1)) || 
-        Vec_IntSize(p->vSuper) > 50 )
+        Vec_IntSize(vSuper) > 50 )
     {
-        Vec_IntPush( p->vSuper, Gia_ObjToLit(p, pObj) );
+        Vec_IntPush( vSuper, Gia_ObjToLit(p, pObj) );
         return;
     }
-    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict );
-    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict );
+    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict, vSuper );
+    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict, vSuper );
 }
-void Gia_ManSuperCollect( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+void Gia_ManSuperCollectInt( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
 {
 //    int nSize;
-    if ( p->vSuper == NULL )
-        p->vSuper = Vec_IntAlloc( 1000 );
-    else
-        Vec_IntClear( p->vSuper );
+    Vec_IntClear( vSuper );
     if ( Gia_ObjIsXor(pObj) )
     {
         assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
-        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict );
-        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict );
+        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict, vSuper );
+        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict, vSuper );
 //        nSize = Vec_IntSize(vSuper);
-        Vec_IntSort( p->vSuper, 0 );
-        Gia_ManSimplifyXor( p->vSuper );
+        Vec_IntSort( vSuper, 0 );
+        Gia_ManSimplifyXor( vSuper );
 //        if ( nSize != Vec_IntSize(vSuper) )
 //            printf( "X %d->%d  ", nSize, Vec_IntSize(vSuper) );
     }
     else if ( Gia_ObjIsAndReal(p, pObj) )
     {
-        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict );
-        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict );
+        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict, vSuper );
+        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict, vSuper );
 //        nSize = Vec_IntSize(vSuper);
-        Vec_IntSort( p->vSuper, 0 );
-        Gia_ManSimplifyAnd( p->vSuper );
+        Vec_IntSort( vSuper, 0 );
+        Gia_ManSimplifyAnd( vSuper );
 //        if ( nSize != Vec_IntSize(vSuper) )
 //            printf( "A %d->%d  ", nSize, Vec_IntSize(vSuper) );
     }
     else assert( 0 );
 //    if ( nSize > 10 )
 //        printf( "%d ", nSize );
+    assert( Vec_IntSize(vSuper) > 0 );
+}
+void Gia_ManSuperCollect( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+{
+    if ( p->vSuper == NULL )
+        p->vSuper = Vec_IntAlloc( 1000 );
+    Gia_ManSuperCollectInt( p, pObj, fStrict, p->vSuper );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the supergates of the AIG in several threads.]
+
+  Description [The supergates are computed level by level, starting from
+  the drivers of the COs and buffers.  The roots of each wavefront are
+  divided among the threads, which collect their supergates concurrently
+  (the AIG and its reference counters are only read).  The leaves of the
+  supergates of the wavefront, which were not seen before, become the
+  roots of the next wavefront.  Buffers and MUXes are transparent.  Returns
+  the array of supergates indexed by object IDs, which is used to rebuild
+  the AIG serially in the same order as without threads.  The reference
+  counters should be computed by the caller.]
+
+  SideEffects [Uses the traversal IDs of the AIG.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManSuperCollectParSchedule( Gia_Man_t * p, int Id, Vec_Int_t * vRoots )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, Id );
+    if ( Gia_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent( p, pObj );
+    if ( !Gia_ObjIsAnd(pObj) )
+        return;
+    if ( Gia_ObjIsBuf(pObj) )
+    {
+        Gia_ManSuperCollectParSchedule( p, Gia_ObjFaninId0(pObj, Id), vRoots );
+        return;
+    }
+    if ( Gia_ObjIsMux(p, pObj) )
+    {
+        Gia_ManSuperCollectParSchedule( p, Gia_ObjFaninId0(pObj, Id), vRoots );
+        Gia_ManSuperCollectParSchedule( p, Gia_ObjFaninId1(pObj, Id), vRoots );
+        Gia_ManSuperCollectParSchedule( p, Gia_ObjFaninId2(p, Id), vRoots );
+        return;
+    }
+    Vec_IntPush( vRoots, Id );
+}
+static int Gia_ManSuperCollectParRound( void * pArg )
+{
+    Gia_BalPar_t * p = (Gia_BalPar_t *)pArg;
+    int i, k, Id, iLit;
+    // the new leaves of the last wavefront become the next wavefront
+    Vec_IntForEachEntry( p->vRoots, Id, i )
+        Vec_IntForEachEntry( Vec_WecEntry(p->vSupers, Id), iLit, k )
+            Gia_ManSuperCollectParSchedule( p->p, Abc_Lit2Var(iLit), p->vNext );
+    ABC_SWAP( Vec_Int_t *, p->vRoots, p->vNext );
+    Vec_IntClear( p->vNext );
+    // small wavefronts are not divided
+    if ( Vec_IntSize(p->vRoots) < GIA_BAL_PAR_MIN )
+        p->nPerThread = Vec_IntSize(p->vRoots);
+    else
+        p->nPerThread = (Vec_IntSize(p->vRoots) + p->nProcs - 1) / p->nProcs;
+    return Vec_IntSize(p->vRoots) > 0;
+}
+static void Gia_ManSuperCollectParThread( void * pArg, int iThread )
+{
+    Gia_BalPar_t * p = (Gia_BalPar_t *)pArg;
+    int i, Id, iBeg = iThread * p->nPerThread;
+    int iEnd = Abc_MinInt( iBeg + p->nPerThread, Vec_IntSize(p->vRoots) );
+    Vec_IntForEachEntryStartStop( p->vRoots, Id, i, iBeg, iEnd )
+        Gia_ManSuperCollectInt( p->p, Gia_ManObj(p->p, Id), p->fStrict, Vec_WecEntry(p->vSupers, Id) );
+}
+Vec_Wec_t * Gia_ManSuperCollectPar( Gia_Man_t * pGia, int fStrict, int nProcs )
+{
+    Gia_BalPar_t Par, * p = &Par;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( pGia->pRefs != NULL );
+    memset( p, 0, sizeof(Gia_BalPar_t) );
+    p->p       = pGia;
+    p->vSupers = Vec_WecStart( Gia_ManObjNum(pGia) );
+    p->vRoots  = Vec_IntAlloc( 1000 );
+    p->vNext   = Vec_IntAlloc( 1000 );
+    p->nProcs  = nProcs;
+    p->fStrict = fStrict;
+    // the first wavefront is made of the drivers of buffers and COs
+    Gia_ManIncrementTravId( pGia );
+    Gia_ManForEachBuf( pGia, pObj, i )
+        Gia_ManSuperCollectParSchedule( pGia, Gia_ObjFaninId0p(pGia, pObj), p->vNext );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Gia_ManSuperCollectParSchedule( pGia, Gia_ObjFaninId0p(pGia, pObj), p->vNext );
+    Util_ProcessThreadsRounds( Gia_ManSuperCollectParRound, Gia_ManSuperCollectParThread, p, nProcs );
+    Vec_IntFree( p->vRoots );
+    Vec_IntFree( p->vNext );
+    return p->vSupers;
+}
+static inline void Gia_ManSuperFetch( Gia_Man_t * p, Vec_Wec_t * vSupers, Gia_Obj_t * pObj, int fStrict )
+{
+    if ( vSupers == NULL )
+    {
+        Gia_ManSuperCollect( p, pObj, fStrict );
+        return;
+    }
+    if ( p->vSuper == NULL )
+        p->vSuper = Vec_IntAlloc( 1000 );
+    Vec_IntClear( p->vSuper );
+    Vec_IntAppend( p->vSuper, Vec_WecEntry(vSupers, Gia_ObjId(p, pObj)) );
     assert( Vec_IntSize(p->vSuper) > 0 );
 }
 
@@ -338,7 +461,7 @@ int Gia_ManBalanceGate( Gia_Man_t * pNew, Gia_Obj_t * pObj, Vec_Int_t * vSuper,
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Wec_t * vSupers )
 {
     int i, iLit, iBeg, iEnd;
     if ( ~pObj->Value )
@@ -348,15 +471,15 @@ void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int
     // handle MUX
     if ( Gia_ObjIsMux(p, pObj) )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin1(pObj), fStrict );
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin2(p, pObj), fStrict );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict, vSupers );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin1(pObj), fStrict, vSupers );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin2(p, pObj), fStrict, vSupers );
         pObj->Value = Gia_ManHashMuxReal( pNew, Gia_ObjFanin2Copy(p, pObj), Gia_ObjFanin1Copy(pObj), Gia_ObjFanin0Copy(pObj) );
         Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
         return;
     }
     // find supergate
-    Gia_ManSuperCollect( p, pObj, fStrict );
+    Gia_ManSuperFetch( p, vSupers, pObj, fStrict );
     // save entries
     if ( p->vStore == NULL )
         p->vStore = Vec_IntAlloc( 1000 );
@@ -367,7 +490,7 @@ void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int
     Vec_IntForEachEntryStartStop( p->vStore, iLit, i, iBeg, iEnd )
     {
         Gia_Obj_t * pTemp = Gia_ManObj( p, Abc_Lit2Var(iLit) );
-        Gia_ManBalance_rec( pNew, p, pTemp, fStrict );
+        Gia_ManBalance_rec( pNew, p, pTemp, fStrict, vSupers );
         Vec_IntWriteEntry( p->vStore, i, Abc_LitNotCond(pTemp->Value, Abc_LitIsCompl(iLit)) );
     }
     assert( Vec_IntSize(p->vStore) == iEnd );
@@ -375,13 +498,17 @@ void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int
     pObj->Value = Gia_ManBalanceGate( pNew, pObj, p->vSuper, Vec_IntEntryP(p->vStore, iBeg), iEnd-iBeg );
     Vec_IntShrink( p->vStore, iBeg );
 }
-Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
+Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict, int nProcs )
 {
     Gia_Man_t * pNew, * pTemp;
     Gia_Obj_t * pObj;
+    Vec_Wec_t * vSupers = NULL;
     int i;
     Gia_ManFillValue( p );
     Gia_ManCreateRefs( p ); 
+    // collect the supergates concurrently
+    if ( nProcs > 1 )
+        vSupers = Gia_ManSuperCollectPar( p, fStrict, nProcs );
     // start the new manager
     pNew = Gia_ManStart( Gia_ManObjNum(p) );
     pNew->pName = Abc_UtilStrsav( p->pName );
@@ -409,17 +536,18 @@ Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
     Gia_ManHashStart( pNew );
     Gia_ManForEachBuf( p, pObj, i )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict, vSupers );
         pObj->Value = Gia_ManAppendBuf( pNew, Gia_ObjFanin0Copy(pObj) );
         Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
     }
     Gia_ManForEachCo( p, pObj, i )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict, vSupers );
         pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
     }
     assert( !fStrict || Gia_ManObjNum(pNew) <= Gia_ManObjNum(p) );
     Gia_ManHashStop( pNew );
+    Vec_WecFreeP( &vSupers );
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
     // perform cleanup
     pNew = Gia_ManCleanup( pTemp = pNew );
@@ -438,14 +566,14 @@ Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVerbose )
+Gia_Man_t * Gia_ManBalancePar( Gia_Man_t * p, int fSimpleAnd, int fStrict, int nProcs, int fVerbose )
 {
     Gia_Man_t * pNew, * pNew1, * pNew2;
     if ( fVerbose )      Gia_ManPrintStats( p, NULL );
     pNew = fSimpleAnd ? Gia_ManDup( p ) : Gia_ManDupMuxes( p, 2 );
     Gia_ManTransferTiming( pNew, p );
     if ( fVerbose )      Gia_ManPrintStats( pNew, NULL );
-    pNew1 = Gia_ManBalanceInt( pNew, fStrict );
+    pNew1 = Gia_ManBalanceInt( pNew, fStrict, nProcs );
     Gia_ManTransferTiming( pNew1, pNew );
     if ( fVerbose )      Gia_ManPrintStats( pNew1, NULL );
     Gia_ManStop( pNew );
@@ -455,6 +583,10 @@ Gia_Man_t * Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVer
     Gia_ManStop( pNew1 );
     return pNew2;
 }
+Gia_Man_t * Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVerbose )
+{
+    return Gia_ManBalancePar( p, fSimpleAnd, fStrict, 0, fVerbose );
+}
 
 
 
@@ -532,7 +664,7 @@ void Dam_ManCollectSets_rec( Dam_Man_t * p, int Id )
         p->nAnds += 3;
         return;
     }
-    Gia_ManSuperCollect( p->pGia, pObj, 0 );
+    Gia_ManSuperFetch( p->pGia, p->vSupers, pObj, 0 );
     Vec_IntWriteEntry( p->vNod2Set, Id, Vec_IntSize(p->vSetStore) );
     Vec_IntPush( p->vSetStore, Vec_IntSize(p->pGia->vSuper) );
     p->nAnds += (1 + 2 * Gia_ObjIsXor(pObj)) * (Vec_IntSize(p->pGia->vSuper) - 1);
@@ -553,8 +685,11 @@ void Dam_ManCollectSets( Dam_Man_t * p )
     p->vSetStore = Vec_IntAlloc( Gia_ManObjNum(p->pGia) );
     Vec_IntPush( p->vSetStore, -1 );
     Vec_IntClear( p->vVisit );
+    if ( p->nProcs > 1 )
+        p->vSupers = Gia_ManSuperCollectPar( p->pGia, 0, p->nProcs );
     Gia_ManForEachCo( p->pGia, pObj, i )
         Dam_ManCollectSets_rec( p, Gia_ObjFaninId0p(p->pGia, pObj) );
+    Vec_WecFreeP( &p->vSupers );
     ABC_FREE( p->pGia->pRefs );
     Gia_ManForEachObjVec( p->vVisit, p->pGia, pObj, i )
         pObj->fMark0 = 0;
@@ -1010,12 +1145,13 @@ void Dam_ManUpdate( Dam_Man_t * p, int iDiv )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Dam_ManAreaBalanceInt( Gia_Man_t * pGia, Vec_Int_t * vCiLevels, int nNewNodesMax, int fVerbose, int fVeryVerbose )
+Gia_Man_t * Dam_ManAreaBalanceInt( Gia_Man_t * pGia, Vec_Int_t * vCiLevels, int nNewNodesMax, int nProcs, int fVerbose, int fVeryVerbose )
 {
     Gia_Man_t * pNew;
     Dam_Man_t * p;
     int i, iDiv;
     p = Dam_ManAlloc( pGia );
+    p->nProcs = nProcs;
     p->nLevelMax = Gia_ManSetLevels( p->pGia, vCiLevels );
     p->vNodLevR = Gia_ManReverseLevel( p->pGia );
     Vec_IntFillExtra( p->pGia->vLevels, 3*Gia_ManObjNum(p->pGia)/2, 0 );
@@ -1044,7 +1180,7 @@ Gia_Man_t * Dam_ManAreaBalanceInt( Gia_Man_t * pGia, Vec_Int_t * vCiLevels, int
     Dam_ManFree( p );
     return pNew;
 }
-Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int fVerbose, int fVeryVerbose )
+Gia_Man_t * Gia_ManAreaBalancePar( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int nProcs, int fVerbose, int fVeryVerbose )
 {
     Gia_Man_t * pNew0, * pNew, * pNew1, * pNew2;
     Vec_Int_t * vCiLevels;
@@ -1077,7 +1213,7 @@ Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax,
     if ( fVerbose )     Gia_ManPrintStats( pNew, NULL );
     if ( pNew0 != p ) Gia_ManStop( pNew0 );
     // perform the operation
-    pNew1 = Dam_ManAreaBalanceInt( pNew, vCiLevels, nNewNodesMax, fVerbose, fVeryVerbose );
+    pNew1 = Dam_ManAreaBalanceInt( pNew, vCiLevels, nNewNodesMax, nProcs, fVerbose, fVeryVerbose );
     Gia_ManTransferTiming( pNew1, pNew );
     if ( fVerbose )     Gia_ManPrintStats( pNew1, NULL );
     Gia_ManStop( pNew );
@@ -1097,6 +1233,10 @@ Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax,
     //Gia_ManTransferTiming( pNew2, p );
     return pNew2;
 }
+Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int fVerbose, int fVeryVerbose )
+{
+    return Gia_ManAreaBalancePar( p, fSimpleAnd, nNewNodesMax, 0, fVerbose, fVeryVerbose );
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
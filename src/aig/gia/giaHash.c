@@ -20,6 +20,16 @@
 
 #include "gia.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -53,7 +63,7 @@ static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize
 }
 static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
+    int iThis, nProbes = 0, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
     assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
@@ -61,9 +71,14 @@ static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iL
     for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
     {
         Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
+        nProbes++;
         if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
             break;
     }
+    p->nHashLookup++;
+    p->nHashProbe += nProbes;
+    if ( p->nHashProbeMax < nProbes )
+        p->nHashProbeMax = nProbes;
     return pPlace;
 }
 
@@ -126,6 +141,7 @@ void Gia_ManHashStart( Gia_Man_t * p )
 {
     Gia_Obj_t * pObj;
     int * pPlace, i;
+    abctime clk = Abc_Clock();
     Gia_ManHashAlloc( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -133,6 +149,7 @@ void Gia_ManHashStart( Gia_Man_t * p )
         assert( *pPlace == 0 );
         *pPlace = i;
     }
+    p->timeHash += Abc_Clock() - clk;
 }
 
 /**Function*************************************************************
@@ -167,6 +184,7 @@ void Gia_ManHashResize( Gia_Man_t * p )
 {
     int i, iThis, iNext, Counter, Counter2, * pPlace;
     Vec_Int_t vOld = p->vHTable;
+    abctime clk = Abc_Clock();
     assert( Vec_IntSize(&vOld) > 0 );
     // replace the table
     Vec_IntZero( &p->vHTable );
@@ -191,6 +209,8 @@ void Gia_ManHashResize( Gia_Man_t * p )
 //    if ( p->fVerbose )
 //        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
     Vec_IntErase( &vOld );
+    p->nHashResize++;
+    p->timeHash += Abc_Clock() - clk;
 }
 
 /**Function********************************************************************
@@ -209,7 +229,7 @@ void Gia_ManHashProfile( Gia_Man_t * p )
     int iEntry;
     int i, Counter, Limit;
     printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
-    printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
+    printf( "Hits = %d. Misses = %d. Lookups = %d. Probes = %d. Resizes = %d.\n", (int)p->nHashHit, (int)p->nHashMiss, (int)p->nHashLookup, (int)p->nHashProbe, p->nHashResize );
     Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
     for ( i = 0; i < Limit; i++ )
     {
@@ -224,6 +244,105 @@ void Gia_ManHashProfile( Gia_Man_t * p )
     printf( "\n" );
 }
 
+/**Function********************************************************************
+
+  Synopsis    [Accumulates the hash table statistics over the managers.]
+
+  Description [The counters of every manager are added to the totals when
+  the manager is deleted, so that the totals cover all commands of a script.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+typedef struct Gia_HashStats_t_ Gia_HashStats_t;
+struct Gia_HashStats_t_
+{
+    word           nMans;         // the number of managers that used the table
+    word           nHit;          // the number of hits
+    word           nMiss;         // the number of misses
+    word           nLookup;       // the number of lookups
+    word           nProbe;        // the number of entries compared
+    word           nResize;       // the number of resizes
+    int            nProbeMax;     // the longest lookup
+    abctime        timeHash;      // the time spent in rehashing
+};
+static Gia_HashStats_t s_HashStats;
+
+static inline void Gia_ManHashStatsAddTo( Gia_HashStats_t * pStats, Gia_Man_t * p )
+{
+    pStats->nMans    += (p->nHashLookup > 0);
+    pStats->nHit     += p->nHashHit;
+    pStats->nMiss    += p->nHashMiss;
+    pStats->nLookup  += p->nHashLookup;
+    pStats->nProbe   += p->nHashProbe;
+    pStats->nResize  += p->nHashResize;
+    pStats->nProbeMax = Abc_MaxInt( pStats->nProbeMax, p->nHashProbeMax );
+    pStats->timeHash += p->timeHash;
+}
+void Gia_ManHashStatsAdd( Gia_Man_t * p )
+{
+    if ( p->nHashLookup == 0 )
+        return;
+#ifdef ABC_USE_PTHREADS
+    {
+        static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
+        pthread_mutex_lock( &Mutex );
+        Gia_ManHashStatsAddTo( &s_HashStats, p );
+        pthread_mutex_unlock( &Mutex );
+    }
+#else
+    Gia_ManHashStatsAddTo( &s_HashStats, p );
+#endif
+}
+void Gia_ManHashStatsReset()
+{
+    memset( &s_HashStats, 0, sizeof(Gia_HashStats_t) );
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Prints the hash table statistics.]
+
+  Description [Prints the table of the manager (if it is allocated) and
+  the totals over the deleted managers and the given one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+void Gia_ManHashStatsPrint( Gia_Man_t * p )
+{
+    Gia_HashStats_t Stats = s_HashStats;
+    if ( p && Vec_IntSize(&p->vHTable) )
+    {
+        int i, iEntry, Counter, nUsed = 0, nEntries = 0, nChainMax = 0;
+        Vec_IntForEachEntry( &p->vHTable, iEntry, i )
+        {
+            for ( Counter = 0; iEntry; iEntry = Vec_IntEntry(&p->vHash, iEntry) )
+                Counter++;
+            nUsed += (Counter > 0);
+            nEntries += Counter;
+            nChainMax = Abc_MaxInt( nChainMax, Counter );
+        }
+        printf( "Current table : Size = %d. Entries = %d. Load = %.2f. Used bins = %d. Chain: ave = %.2f  max = %d.\n",
+            Vec_IntSize(&p->vHTable), nEntries, 1.0 * nEntries / Vec_IntSize(&p->vHTable), nUsed,
+            nUsed ? 1.0 * nEntries / nUsed : 0.0, nChainMax );
+    }
+    else if ( p )
+        printf( "Current table : The hash table of the current AIG is not allocated.\n" );
+    if ( p )
+        Gia_ManHashStatsAddTo( &Stats, p );
+    printf( "Script totals : Managers = %.0f. Lookups = %.0f. Hits = %.0f. Misses = %.0f. Hit rate = %.2f %%.\n",
+        (double)Stats.nMans, (double)Stats.nLookup, (double)Stats.nHit, (double)Stats.nMiss,
+        Stats.nHit + Stats.nMiss ? 100.0 * Stats.nHit / (Stats.nHit + Stats.nMiss) : 0.0 );
+    printf( "Script totals : Probes: ave = %.2f  max = %d. Resizes = %.0f. ",
+        Stats.nLookup ? 1.0 * Stats.nProbe / Stats.nLookup : 0.0, Stats.nProbeMax, (double)Stats.nResize );
+    Abc_PrintTime( 1, "Rehashing time", Stats.timeHash );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Recognizes what nodes are control and data inputs of a MUX.]
@@ -0,0 +1,536 @@
+/**CFile****************************************************************
+
+  FileName    [giaHashPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent structural hashing.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the concurrent table is used by several threads only if atomics are available
+#if defined(ABC_USE_PTHREADS) && (defined(__GNUC__) || defined(__clang__))
+#define GIA_HASH_PAR_ATOMIC 1
+static inline int  Gia_HashParLoad( int * p )                     { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                          }
+static inline int  Gia_HashParCas( int * p, int Old, int New )    { return __atomic_compare_exchange_n( p, &Old, New, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ); }
+static inline int  Gia_HashParFetchAdd( int * p, int Add )        { return __atomic_fetch_add( p, Add, __ATOMIC_RELAXED );                                  }
+static inline void Gia_HashParStore( int * p, int Value )         { __atomic_store_n( p, Value, __ATOMIC_RELEASE );                                         }
+#else
+#define GIA_HASH_PAR_ATOMIC 0
+static inline int  Gia_HashParLoad( int * p )                     { return *p;                                 }
+static inline int  Gia_HashParCas( int * p, int Old, int New )    { if ( *p != Old ) return 0; *p = New; return 1; }
+static inline int  Gia_HashParFetchAdd( int * p, int Add )        { int Old = *p; *p += Add; return Old;       }
+static inline void Gia_HashParStore( int * p, int Value )         { *p = Value;                                }
+#endif
+
+#define GIA_HASH_PAR_CHUNK  256   // the number of nodes reserved by a thread at a time
+
+typedef struct Gia_HashParThr_t_ Gia_HashParThr_t;
+struct Gia_HashParThr_t_
+{
+    int            iNext;         // the next reserved node
+    int            iStop;         // the end of the reserved nodes
+    int            iSpare;        // the node allocated for a lost insertion (or 0)
+    int            nHits;         // the number of lookups that found the node
+    int            nRaces;        // the number of insertions lost to another thread
+    int            Pad[11];       // keeps the threads on different cache lines
+};
+
+struct Gia_HashPar_t_
+{
+    Gia_Man_t *    pGia;          // the manager whose objects are the base of the new nodes
+    int            nObjsBase;     // the number of objects in the manager when started
+    int            nNodesMax;     // the max number of new nodes
+    int            nNodesUsed;    // the number of reserved nodes (updated concurrently)
+    int            fOverflow;     // set when a thread could not allocate a node
+    int *          pFans;         // the fanin literals of the new nodes (-1 for unused)
+    int *          pTable;        // the open-addressing table of the new nodes (0 for empty)
+    int            nTableMask;    // the table size minus one
+    int            nThreads;      // the number of threads
+    Gia_HashParThr_t * pThrs;     // the per-thread data
+    Vec_Int_t *    vMap;          // the new nodes mapped into the manager by the transfer
+};
+
+// the new node k (k > 0) is the object nObjsBase + k - 1 in the literal space
+static inline int  Gia_HashParNodeVar( Gia_HashPar_t * p, int k )  { return p->nObjsBase + k - 1;  }
+static inline int  Gia_HashParVarNode( Gia_HashPar_t * p, int v )  { return v - p->nObjsBase + 1;  }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the concurrent structural hashing.]
+
+  Description [The new nodes are built on top of the objects present in
+  the manager, whose literals can be used as fanins. The table cannot be
+  resized while the threads are using it, so it is sized up front for
+  nNodesMax new nodes (plus the slack for the nodes reserved by the
+  threads but not used), which should be an upper bound on the number of
+  nodes built, such as the number of AND nodes of the AIG being rehashed.
+  If the bound is exceeded, Gia_HashParAnd() returns -1. The threads are
+  numbered from 0 to nThreads-1. If atomic operations are not available,
+  the table can only be used by one thread at a time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_HashPar_t * Gia_HashParStart( Gia_Man_t * pGia, int nNodesMax, int nThreads )
+{
+    Gia_HashPar_t * p;
+    int nTableSize;
+    assert( pGia->pMuxes == NULL );
+    assert( nThreads >= 1 );
+    nNodesMax += nThreads * GIA_HASH_PAR_CHUNK;
+    nTableSize = 1 << Abc_Base2Log( 2 * nNodesMax );
+    p = ABC_CALLOC( Gia_HashPar_t, 1 );
+    p->pGia       = pGia;
+    p->nObjsBase  = Gia_ManObjNum(pGia);
+    p->nNodesMax  = nNodesMax;
+    p->pFans      = ABC_FALLOC( int, 2 * (nNodesMax + 1) );
+    p->pTable     = ABC_CALLOC( int, nTableSize );
+    p->nTableMask = nTableSize - 1;
+    p->nThreads   = nThreads;
+    p->pThrs      = ABC_CALLOC( Gia_HashParThr_t, nThreads );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the concurrent structural hashing.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_HashParStop( Gia_HashPar_t * p )
+{
+    Vec_IntFreeP( &p->vMap );
+    ABC_FREE( p->pThrs );
+    ABC_FREE( p->pTable );
+    ABC_FREE( p->pFans );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the table entry for the pair of literals.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_HashParKey( Gia_HashPar_t * p, int iLit0, int iLit1 )
+{
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1 + (unsigned)iLit1 * 0x85EBCA77;
+    Key ^= Key >> 15;
+    Key *= 0x2C1B3C6D;
+    Key ^= Key >> 12;
+    return (int)(Key & p->nTableMask);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates a new node for the thread.]
+
+  Description [The nodes are reserved in chunks to avoid contention on
+  the shared counter. The chunks of different threads interleave, so the
+  new nodes are not in a topological order and can leave gaps; both are
+  fixed by Gia_HashParTransfer(). Returns 0 if the limit on the number
+  of nodes is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_HashParAlloc( Gia_HashPar_t * p, Gia_HashParThr_t * pThr )
+{
+    int iNode;
+    if ( pThr->iSpare )
+    {
+        iNode = pThr->iSpare;
+        pThr->iSpare = 0;
+        return iNode;
+    }
+    if ( pThr->iNext == pThr->iStop )
+    {
+        pThr->iNext = 1 + Gia_HashParFetchAdd( &p->nNodesUsed, GIA_HASH_PAR_CHUNK );
+        pThr->iStop = Abc_MinInt( pThr->iNext + GIA_HASH_PAR_CHUNK, p->nNodesMax + 1 );
+        if ( pThr->iNext >= pThr->iStop )
+        {
+            pThr->iNext = pThr->iStop;
+            Gia_HashParStore( &p->fOverflow, 1 );
+            return 0;
+        }
+    }
+    return pThr->iNext++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the AND node or returns the existing one.]
+
+  Description [Can be called by several threads at the same time. The
+  nodes are hashed in the open-addressing table whose empty buckets are
+  claimed by compare-and-swap, so that all threads get the same literal
+  for the same pair of fanins. The fanins of a node are written before
+  its bucket is claimed and are never changed afterwards. Returns -1 if
+  the limit on the number of new nodes is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_HashParAnd( Gia_HashPar_t * p, int iThread, int iLit0, int iLit1 )
+{
+    Gia_HashParThr_t * pThr = p->pThrs + iThread;
+    int iPlace, iThis, iNode = 0;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    // look up the nodes of the manager (its table is not modified meanwhile)
+    if ( Abc_Lit2Var(iLit1) < p->nObjsBase && Vec_IntSize(&p->pGia->vHTable) )
+    {
+        int iLit = Gia_ManHashLookupInt( p->pGia, iLit0, iLit1 );
+        if ( iLit )
+            return iLit;
+    }
+    for ( iPlace = Gia_HashParKey(p, iLit0, iLit1); ; iPlace = (iPlace + 1) & p->nTableMask )
+    {
+        iThis = Gia_HashParLoad( p->pTable + iPlace );
+        if ( iThis == 0 )
+        {
+            // prepare the node and try to claim the empty bucket
+            if ( iNode == 0 )
+            {
+                iNode = Gia_HashParAlloc( p, pThr );
+                if ( iNode == 0 )
+                    return -1;
+                p->pFans[2*iNode+0] = iLit0;
+                p->pFans[2*iNode+1] = iLit1;
+            }
+            if ( Gia_HashParCas( p->pTable + iPlace, 0, iNode ) )
+                return Abc_Var2Lit( Gia_HashParNodeVar(p, iNode), 0 );
+            // another thread took the bucket; look at its node
+            iThis = Gia_HashParLoad( p->pTable + iPlace );
+        }
+        if ( p->pFans[2*iThis+0] == iLit0 && p->pFans[2*iThis+1] == iLit1 )
+        {
+            if ( iNode )
+            {
+                // the node was created by another thread; keep ours for later
+                p->pFans[2*iNode+0] = p->pFans[2*iNode+1] = -1;
+                pThr->iSpare = iNode;
+                pThr->nRaces++;
+            }
+            else
+                pThr->nHits++;
+            return Abc_Var2Lit( Gia_HashParNodeVar(p, iThis), 0 );
+        }
+    }
+    assert( 0 );
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the new nodes into the manager.]
+
+  Description [Must be called after all threads are finished. Adds the
+  new nodes reachable from the literals in vLits to the manager, using
+  structural hashing if the hash table of the manager is started, and
+  translates the literals in vLits into the literals of the manager.
+  The nodes are added in a topological order, in which they are first
+  reached from the literals taken in the order of vLits, rather than in
+  the order of their slots, which depends on the timing of the threads.
+  So the result depends only on the literals and their order.  After
+  this, the literals of the transferred nodes can be translated by
+  Gia_HashParLit(). The new nodes are visited using an explicit stack,
+  so that deep AIGs do not overflow the system stack.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_HashParLit( Gia_HashPar_t * p, int iLit )
+{
+    int iNode = Gia_HashParVarNode( p, Abc_Lit2Var(iLit) );
+    if ( iNode <= 0 )
+        return iLit;
+    assert( Vec_IntEntry(p->vMap, iNode) >= 0 );
+    return Abc_LitNotCond( Vec_IntEntry(p->vMap, iNode), Abc_LitIsCompl(iLit) );
+}
+static inline int Gia_HashParFaninNode( Gia_HashPar_t * p, int iNode, int i )
+{
+    int iFan = Gia_HashParVarNode( p, Abc_Lit2Var(p->pFans[2*iNode+i]) );
+    return (iFan > 0 && Vec_IntEntry(p->vMap, iFan) < 0) ? iFan : 0;
+}
+static void Gia_HashParTransferNode( Gia_HashPar_t * p, Vec_Int_t * vStack, int iRoot )
+{
+    int iNode, iFan0, iFan1, iLit0, iLit1, iRes;
+    Vec_IntPush( vStack, iRoot );
+    while ( Vec_IntSize(vStack) )
+    {
+        iNode = Vec_IntEntryLast( vStack );
+        if ( Vec_IntEntry(p->vMap, iNode) >= 0 )
+        {
+            Vec_IntPop( vStack );
+            continue;
+        }
+        // add the fanins first
+        iFan0 = Gia_HashParFaninNode( p, iNode, 0 );
+        iFan1 = Gia_HashParFaninNode( p, iNode, 1 );
+        if ( iFan0 || iFan1 )
+        {
+            if ( iFan1 )
+                Vec_IntPush( vStack, iFan1 );
+            if ( iFan0 )
+                Vec_IntPush( vStack, iFan0 );
+            continue;
+        }
+        iLit0 = Gia_HashParLit( p, p->pFans[2*iNode+0] );
+        iLit1 = Gia_HashParLit( p, p->pFans[2*iNode+1] );
+        if ( Vec_IntSize(&p->pGia->vHTable) )
+            iRes = Gia_ManHashAnd( p->pGia, iLit0, iLit1 );
+        else
+            iRes = Gia_ManAppendAnd( p->pGia, iLit0, iLit1 );
+        Vec_IntWriteEntry( p->vMap, iNode, iRes );
+        Vec_IntPop( vStack );
+    }
+}
+void Gia_HashParTransfer( Gia_HashPar_t * p, Vec_Int_t * vLits )
+{
+    Vec_Int_t * vStack;
+    int i, iLit, iNode, nNodes = Abc_MinInt( p->nNodesUsed, p->nNodesMax );
+    assert( p->vMap == NULL );
+    assert( Gia_ManObjNum(p->pGia) == p->nObjsBase );
+    p->vMap = Vec_IntStartFull( nNodes + 1 );
+    vStack = Vec_IntAlloc( 1000 );
+    Vec_IntForEachEntry( vLits, iLit, i )
+    {
+        iNode = Gia_HashParVarNode( p, Abc_Lit2Var(iLit) );
+        if ( iNode > 0 )
+            Gia_HashParTransferNode( p, vStack, iNode );
+        Vec_IntWriteEntry( vLits, i, Gia_HashParLit(p, iLit) );
+    }
+    Vec_IntFree( vStack );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the concurrent structural hashing.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_HashParPrintStats( Gia_HashPar_t * p )
+{
+    int i, nHits = 0, nRaces = 0, nGaps = 0, nNodes = Abc_MinInt( p->nNodesUsed, p->nNodesMax );
+    for ( i = 0; i < p->nThreads; i++ )
+        nHits += p->pThrs[i].nHits, nRaces += p->pThrs[i].nRaces;
+    for ( i = 1; i <= nNodes; i++ )
+        nGaps += (p->pFans[2*i] < 0);
+    printf( "Threads = %d.  Nodes = %d.  Hits = %d.  Races = %d.  Gaps = %d.  Table = %d.\n",
+        p->nThreads, nNodes - nGaps, nHits, nRaces, nGaps, p->nTableMask + 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes the AIG using several threads.]
+
+  Description [The COs are divided into nThreads groups of consecutive
+  outputs and every thread builds the cones of its group. The shared
+  nodes of the cones may be built by several threads at the same time;
+  the concurrent table makes them converge to one node. The table is
+  sized by the number of AND nodes, which bounds the number of the new
+  nodes. The nodes are then transferred in the order of the AND nodes
+  of the AIG, so the result does not depend on the number of threads or
+  their timing and is the same as that of Gia_ManRehash(). For this, the
+  AIG should have the CIs first and the COs last; otherwise, it is
+  rehashed by Gia_ManRehash(). Returns NULL if the table overflows.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_RehashParJob_t_ Gia_RehashParJob_t;
+struct Gia_RehashParJob_t_
+{
+    Gia_Man_t *     p;            // the original AIG
+    Gia_HashPar_t * pHash;        // the concurrent table
+    int *           pCopies;      // the literals of the objects (-1 if not built yet)
+    Vec_Int_t *     vStack;       // the objects being built
+    int             iThread;      // the thread number
+    int             iCoStart;     // the first CO of the group
+    int             iCoStop;      // the CO following the last one
+};
+static inline int Gia_ManRehashParFanin( Gia_RehashParJob_t * pJob, int iFan )
+{
+    return Gia_HashParLoad( pJob->pCopies + iFan ) < 0 ? iFan : 0;
+}
+static int Gia_ManRehashParCone( Gia_RehashParJob_t * pJob, int iRoot )
+{
+    Gia_Obj_t * pObj;
+    int iObj, iFan0, iFan1, iLit0, iLit1, iLit;
+    Vec_IntClear( pJob->vStack );
+    Vec_IntPush( pJob->vStack, iRoot );
+    while ( Vec_IntSize(pJob->vStack) )
+    {
+        iObj = Vec_IntEntryLast( pJob->vStack );
+        if ( Gia_HashParLoad( pJob->pCopies + iObj ) >= 0 )
+        {
+            Vec_IntPop( pJob->vStack );
+            continue;
+        }
+        pObj = Gia_ManObj( pJob->p, iObj );
+        assert( Gia_ObjIsAnd(pObj) );
+        // build the fanins first
+        iFan0 = Gia_ManRehashParFanin( pJob, Gia_ObjFaninId0(pObj, iObj) );
+        iFan1 = Gia_ManRehashParFanin( pJob, Gia_ObjFaninId1(pObj, iObj) );
+        if ( iFan0 || iFan1 )
+        {
+            if ( iFan1 )
+                Vec_IntPush( pJob->vStack, iFan1 );
+            if ( iFan0 )
+                Vec_IntPush( pJob->vStack, iFan0 );
+            continue;
+        }
+        iLit0 = Abc_LitNotCond( Gia_HashParLoad(pJob->pCopies + Gia_ObjFaninId0(pObj, iObj)), Gia_ObjFaninC0(pObj) );
+        iLit1 = Abc_LitNotCond( Gia_HashParLoad(pJob->pCopies + Gia_ObjFaninId1(pObj, iObj)), Gia_ObjFaninC1(pObj) );
+        iLit  = Gia_HashParAnd( pJob->pHash, pJob->iThread, iLit0, iLit1 );
+        if ( iLit < 0 )
+            return 0;
+        Gia_HashParStore( pJob->pCopies + iObj, iLit );
+        Vec_IntPop( pJob->vStack );
+    }
+    return 1;
+}
+static int Gia_ManRehashParThread( void * pArg )
+{
+    Gia_RehashParJob_t * pJob = (Gia_RehashParJob_t *)pArg;
+    int i;
+    for ( i = pJob->iCoStart; i < pJob->iCoStop; i++ )
+        if ( !Gia_ManRehashParCone( pJob, Gia_ObjFaninId0p(pJob->p, Gia_ManCo(pJob->p, i)) ) )
+            break;
+    return 1;
+}
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nThreads, int fVerbose )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Gia_HashPar_t * pHash;
+    Gia_RehashParJob_t * pJobs;
+    Vec_Ptr_t * vJobs;
+    Vec_Int_t * vLits;
+    Gia_Obj_t * pObj;
+    int i, * pCopies;
+    assert( p->pMuxes == NULL && Gia_ManBufNum(p) == 0 );
+    if ( !Gia_ManIsNormalized(p) )
+        return Gia_ManRehash( p, 0 );
+    if ( !GIA_HASH_PAR_ATOMIC )
+        nThreads = 1;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, Gia_ManCoNum(p)) );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pCopies = ABC_FALLOC( int, Gia_ManObjNum(p) );
+    pCopies[0] = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pCopies[Gia_ObjId(p, pObj)] = Gia_ManAppendCi( pNew );
+    // build the cones concurrently
+    pHash = Gia_HashParStart( pNew, Gia_ManAndNum(p), nThreads );
+    pJobs = ABC_CALLOC( Gia_RehashParJob_t, nThreads );
+    vJobs = Vec_PtrAlloc( nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pJobs[i].p        = p;
+        pJobs[i].pHash    = pHash;
+        pJobs[i].pCopies  = pCopies;
+        pJobs[i].vStack   = Vec_IntAlloc( 1000 );
+        pJobs[i].iThread  = i;
+        pJobs[i].iCoStart = (int)((word)Gia_ManCoNum(p) * i / nThreads);
+        pJobs[i].iCoStop  = (int)((word)Gia_ManCoNum(p) * (i+1) / nThreads);
+        Vec_PtrPush( vJobs, pJobs + i );
+    }
+    // the calling thread only dispatches the jobs
+    Util_ProcessThreads( Gia_ManRehashParThread, vJobs, nThreads > 1 ? nThreads + 1 : 1, 0, 0 );
+    // build the dangling nodes, which Gia_ManRehash() also creates
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( pCopies[i] < 0 && !pHash->fOverflow )
+            Gia_ManRehashParCone( pJobs, i );
+    for ( i = 0; i < nThreads; i++ )
+        Vec_IntFree( pJobs[i].vStack );
+    Vec_PtrFree( vJobs );
+    ABC_FREE( pJobs );
+    if ( pHash->fOverflow )
+    {
+        Gia_HashParStop( pHash );
+        ABC_FREE( pCopies );
+        Gia_ManStop( pNew );
+        return NULL;
+    }
+    // add the new nodes in the order of the AND nodes, followed by the COs
+    vLits = Vec_IntAlloc( Gia_ManAndNum(p) + Gia_ManCoNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntPush( vLits, pCopies[i] );
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_IntPush( vLits, Abc_LitNotCond(pCopies[Gia_ObjFaninId0p(p, pObj)], Gia_ObjFaninC0(pObj)) );
+    Gia_HashParTransfer( pHash, vLits );
+    if ( fVerbose )
+        Gia_HashParPrintStats( pHash );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Vec_IntEntry(vLits, Gia_ManAndNum(p) + i) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    Gia_HashParStop( pHash );
+    Vec_IntFree( vLits );
+    ABC_FREE( pCopies );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -23,6 +23,7 @@
 #include "map/if/if.h"
 #include "bool/kit/kit.h"
 #include "base/main/main.h"
+#include "misc/util/utilJson.h"
 #include "sat/bsat/satSolver.h"
 
 #ifdef WIN32
@@ -529,14 +530,12 @@ void Gia_ManPrintOutputLutStats( Gia_Man_t * p )
     Vec_IntFree( vLevel );
 }
 
-void Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile )
+static void Gia_ManComputeMappingStats( Gia_Man_t * p, int * pnLutSize, int * pnLuts, int * pnFanins, int * pLevelMax, int * pAve, int * pnMuxF )
 {
     int fDisable2Lut = 1;
     Gia_Obj_t * pObj;
     int * pLevels;
     int i, k, iFan, nLutSize = 0, nLuts = 0, nFanins = 0, LevelMax = 0, Ave = 0, nMuxF = 0;
-    if ( !Gia_ManHasMapping(p) )
-        return;
     pLevels = ABC_CALLOC( int, Gia_ManObjNum(p) );
     Gia_ManForEachLut( p, i )
     {
@@ -572,6 +571,19 @@ void Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile )
     Gia_ManForEachCo( p, pObj, i )
         Ave += pLevels[Gia_ObjFaninId0p(p, pObj)];
     ABC_FREE( pLevels );
+    *pnLutSize = nLutSize;
+    *pnLuts    = nLuts;
+    *pnFanins  = nFanins;
+    *pLevelMax = LevelMax;
+    *pAve      = Ave;
+    *pnMuxF    = nMuxF;
+}
+void Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile )
+{
+    int nLutSize, nLuts, nFanins, LevelMax, Ave, nMuxF;
+    if ( !Gia_ManHasMapping(p) )
+        return;
+    Gia_ManComputeMappingStats( p, &nLutSize, &nLuts, &nFanins, &LevelMax, &Ave, &nMuxF );
 
 #ifdef WIN32
     {
@@ -648,6 +660,25 @@ void Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile )
     }
 
 }
+void Gia_ManPrintMappingStatsJson( Gia_Man_t * p, void * pJson )
+{
+    Json_Wrt_t * pWrt = (Json_Wrt_t *)pJson;
+    int nLutSize, nLuts, nFanins, LevelMax, Ave, nMuxF;
+    if ( !Gia_ManHasMapping(p) )
+        return;
+    Gia_ManComputeMappingStats( p, &nLutSize, &nLuts, &nFanins, &LevelMax, &Ave, &nMuxF );
+    Json_WrtObjStart( pWrt, "mapping" );
+    Json_WrtInt( pWrt, "lut_size", nLutSize );
+    Json_WrtInt( pWrt, "luts", nLuts );
+    Json_WrtInt( pWrt, "muxf", nMuxF );
+    Json_WrtInt( pWrt, "edges", nFanins );
+    Json_WrtInt( pWrt, "levels", LevelMax );
+    Json_WrtFloat( pWrt, "level_ave", Gia_ManCoNum(p) ? (float)Ave / Gia_ManCoNum(p) : 0 );
+    if ( p->pManTime && Tim_ManBoxNum((Tim_Man_t *)p->pManTime) )
+        Json_WrtInt( pWrt, "levels_boxes", Gia_ManLutLevelWithBoxes(p) );
+    Json_WrtFloat( pWrt, "mem_mb", 4.0*(Gia_ManObjNum(p) + 2*nLuts + nFanins)/(1<<20) );
+    Json_WrtObjStop( pWrt );
+}
 
 /**Function*************************************************************
 
@@ -25,6 +25,7 @@
 #include "proof/abs/abs.h"
 #include "opt/dar/dar.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilJson.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -81,6 +82,7 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
 ***********************************************************************/
 void Gia_ManStop( Gia_Man_t * p )
 {
+    Gia_ManHashStatsAdd( p );
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
     Gia_ManStaticFanoutStop( p );
@@ -644,6 +646,58 @@ void Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars )
         Gia_ManPrintOutputLutStats( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes stats for the AIG into the JSON record.]
+
+  Description [Writes the metrics printed by Gia_ManPrintStats().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManPrintStatsJson( Gia_Man_t * p, Gps_Par_t * pPars, void * pJson )
+{
+    extern float Gia_ManLevelAve( Gia_Man_t * p );
+    Json_Wrt_t * pWrt = (Json_Wrt_t *)pJson;
+    int fHaveLevels = p->vLevels != NULL;
+    Json_WrtStr( pWrt, "name", p->pName );
+    Json_WrtInt( pWrt, "pis", Gia_ManPiNum(p) - Gia_ManBoxCiNum(p) - Gia_ManRegBoxNum(p) );
+    Json_WrtInt( pWrt, "pos", Gia_ManPoNum(p) - Gia_ManBoxCoNum(p) - Gia_ManRegBoxNum(p) );
+    Json_WrtInt( pWrt, "constraints", Gia_ManConstrNum(p) );
+    Json_WrtInt( pWrt, "ffs", Gia_ManRegNum(p) );
+    if ( Gia_ManRegBoxNum(p) )
+    {
+        Json_WrtInt( pWrt, "box_ffs", Gia_ManRegBoxNum(p) );
+        Json_WrtInt( pWrt, "clock_domains", Gia_ManClockDomainNum(p) );
+    }
+    Json_WrtInt( pWrt, p->pMuxes ? "nodes" : "ands", Gia_ManAndNum(p) );
+    Json_WrtInt( pWrt, "levels", Gia_ManLevelNum(p) );
+    Json_WrtFloat( pWrt, "level_ave", Gia_ManLevelAve(p) );
+    if ( !fHaveLevels ) 
+        Vec_IntFreeP( &p->vLevels );
+    if ( pPars && pPars->fCut )
+    {
+        Json_WrtInt( pWrt, "cut", Gia_ManCrossCut(p, 0) );
+        Json_WrtInt( pWrt, "cut_reverse", Gia_ManCrossCut(p, 1) );
+    }
+    Json_WrtFloat( pWrt, "mem_mb", Gia_ManMemory(p)/(1<<20) );
+    Json_WrtInt( pWrt, "choices", Gia_ManHasChoices(p) ? Gia_ManChoiceNum(p) : 0 );
+    if ( p->pManTime )
+    {
+        Json_WrtInt( pWrt, "boxes", Gia_ManNonRegBoxNum(p) );
+        Json_WrtInt( pWrt, "black_boxes", Gia_ManBlackBoxNum(p) );
+    }
+    Json_WrtInt( pWrt, "buffers", Gia_ManBufNum(p) );
+    if ( p->pMuxes == NULL )
+        Json_WrtInt( pWrt, "xors", Gia_ManXorNum(p) );
+    if ( pPars && pPars->fSwitch )
+        Json_WrtFloat( pWrt, "power", Gia_ManComputeSwitching( p, 48, 16, 0 ) );
+    if ( Gia_ManHasMapping(p) && (pPars == NULL || !pPars->fSkipMap) )
+        Gia_ManPrintMappingStatsJson( p, pJson );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Prints stats for the AIG.]
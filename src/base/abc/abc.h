@@ -369,6 +369,7 @@ static inline int         Abc_ObjFanoutNum( Abc_Obj_t * pObj )       { return pO
 static inline int         Abc_ObjFaninId( Abc_Obj_t * pObj, int i)   { return pObj->vFanins.pArray[i]; }
 static inline int         Abc_ObjFaninId0( Abc_Obj_t * pObj )        { return pObj->vFanins.pArray[0]; }
 static inline int         Abc_ObjFaninId1( Abc_Obj_t * pObj )        { return pObj->vFanins.pArray[1]; }
+static inline int         Abc_ObjFanoutId( Abc_Obj_t * pObj, int i)  { return pObj->vFanouts.pArray[i]; }
 static inline int         Abc_ObjFanoutEdgeNum( Abc_Obj_t * pObj, Abc_Obj_t * pFanout )  { assert( Abc_NtkHasAig(pObj->pNtk) );  if ( Abc_ObjFaninId0(pFanout) == pObj->Id ) return 0; if ( Abc_ObjFaninId1(pFanout) == pObj->Id ) return 1; assert( 0 ); return -1;  }
 static inline Abc_Obj_t * Abc_ObjFanout( Abc_Obj_t * pObj, int i )   { return (Abc_Obj_t *)pObj->pNtk->vObjs->pArray[ pObj->vFanouts.pArray[i] ];  }
 static inline Abc_Obj_t * Abc_ObjFanout0( Abc_Obj_t * pObj )         { return (Abc_Obj_t *)pObj->pNtk->vObjs->pArray[ pObj->vFanouts.pArray[0] ];  }
@@ -572,6 +573,8 @@ extern ABC_DLL void               Abc_AigSetNodePhases( Abc_Ntk_t * pNtk );
 extern ABC_DLL Vec_Ptr_t *        Abc_AigUpdateStart( Abc_Aig_t * pMan, Vec_Ptr_t ** pvUpdatedNets );
 extern ABC_DLL void               Abc_AigUpdateStop( Abc_Aig_t * pMan );
 extern ABC_DLL void               Abc_AigUpdateReset( Abc_Aig_t * pMan );
+extern ABC_DLL Vec_Int_t *        Abc_AigModifiedStart( Abc_Aig_t * pMan );
+extern ABC_DLL void               Abc_AigModifiedStop( Abc_Aig_t * pMan );
 /*=== abcAttach.c ==========================================================*/
 extern ABC_DLL int                Abc_NtkAttach( Abc_Ntk_t * pNtk );
 /*=== abcBarBuf.c ==========================================================*/
@@ -590,6 +593,7 @@ extern ABC_DLL char *             Abc_NodeConvertSopToMvSop( int nVars, Vec_Int_
 extern ABC_DLL int                Abc_NodeEvalMvCost( int nVars, Vec_Int_t * vSop0, Vec_Int_t * vSop1 );
 /*=== abcBalance.c ==========================================================*/
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkBalance( Abc_Ntk_t * pNtk, int  fDuplicate, int  fSelective, int  fUpdateLevel );
+extern ABC_DLL Abc_Ntk_t *        Abc_NtkBalancePar( Abc_Ntk_t * pNtk, int  fDuplicate, int  fSelective, int  fUpdateLevel, int nProcs );
 /*=== abcCheck.c ==========================================================*/
 extern ABC_DLL int                Abc_NtkCheck( Abc_Ntk_t * pNtk );
 extern ABC_DLL int                Abc_NtkCheckRead( Abc_Ntk_t * pNtk );
@@ -610,6 +614,7 @@ extern ABC_DLL void *             Abc_NodeGetCuts( void * p, Abc_Obj_t * pObj, i
 extern ABC_DLL void               Abc_NodeGetCutsSeq( void * p, Abc_Obj_t * pObj, int fFirst );
 extern ABC_DLL void *             Abc_NodeReadCuts( void * p, Abc_Obj_t * pObj );
 extern ABC_DLL void               Abc_NodeFreeCuts( void * p, Abc_Obj_t * pObj );
+extern ABC_DLL void               Abc_NtkFreeCutsModified( void * p, Abc_Ntk_t * pNtk, Vec_Int_t * vModified );
 /*=== abcDar.c ============================================================*/
 extern ABC_DLL int                Abc_NtkPhaseFrameNum( Abc_Ntk_t * pNtk );
 extern ABC_DLL int                Abc_NtkDarPrintCone( Abc_Ntk_t * pNtk );
@@ -838,6 +843,7 @@ extern ABC_DLL int                Abc_NtkDontCareCompute( Odc_Man_t * p, Abc_Obj
 extern ABC_DLL float              Abc_NtkMfsTotalSwitching( Abc_Ntk_t * pNtk );
 extern ABC_DLL float              Abc_NtkMfsTotalGlitching( Abc_Ntk_t * pNtk, int nPats, int Prob, int fVerbose );
 extern ABC_DLL void               Abc_NtkPrintStats( Abc_Ntk_t * pNtk, int fFactored, int fSaveBest, int fDumpResult, int fUseLutLib, int fPrintMuxes, int fPower, int fGlitch, int fSkipBuf, int fSkipSmall, int fPrintMem );
+extern ABC_DLL void               Abc_NtkPrintStatsJson( Abc_Ntk_t * pNtk, void * pJson, int fFactored, int fUseLutLib, int fPrintMuxes, int fPower, int fGlitch, int fSkipBuf, int fSkipSmall, int fPrintMem );
 extern ABC_DLL void               Abc_NtkPrintIo( FILE * pFile, Abc_Ntk_t * pNtk, int fPrintFlops );
 extern ABC_DLL void               Abc_NtkPrintLatch( FILE * pFile, Abc_Ntk_t * pNtk );
 extern ABC_DLL void               Abc_NtkPrintFanio( FILE * pFile, Abc_Ntk_t * pNtk, int fUseFanio, int fUsePio, int fUseSupp, int fUseCone );
@@ -63,6 +63,7 @@ struct Abc_Aig_t_
     Vec_Vec_t *       vLevelsR;          // the nodes to be updated
     Vec_Ptr_t *       vAddedCells;       // the added nodes
     Vec_Ptr_t *       vUpdatedNets;      // the nodes whose fanouts have changed
+    Vec_Int_t *       vModified;         // the IDs of the nodes whose fanins have changed or which were deleted
 
     int               nStrash0;
     int               nStrash1;
@@ -171,6 +172,8 @@ void Abc_AigFree( Abc_Aig_t * pMan )
         Vec_PtrFree( pMan->vAddedCells );
     if ( pMan->vUpdatedNets )
         Vec_PtrFree( pMan->vUpdatedNets );
+    if ( pMan->vModified )
+        Vec_IntFree( pMan->vModified );
     Vec_VecFree( pMan->vLevels );
     Vec_VecFree( pMan->vLevelsR );
     Vec_PtrFree( pMan->vStackReplaceOld );
@@ -949,6 +952,9 @@ void Abc_AigReplace_int( Abc_Aig_t * pMan, Abc_Obj_t * pOld, Abc_Obj_t * pNew, i
         // recreate the old fanout with new fanins and add it to the table
         Abc_AigAndCreateFrom( pMan, pFanin1, pFanin2, pFanout );
         assert( Abc_AigNodeIsAcyclic(pFanout, pFanout) );
+        // remember that the structure below the fanout has changed
+        if ( pMan->vModified )
+            Vec_IntPush( pMan->vModified, pFanout->Id );
 
         if ( fUpdateLevel )
         {
@@ -1026,6 +1032,8 @@ void Abc_AigDeleteNode( Abc_Aig_t * pMan, Abc_Obj_t * pNode )
         Vec_PtrPushUnique( pMan->vUpdatedNets, pNode0 );
         Vec_PtrPushUnique( pMan->vUpdatedNets, pNode1 );
     }
+    if ( pMan->vModified )
+        Vec_IntPush( pMan->vModified, pNode->Id );
 
     // remove the node from the table
     Abc_AigAndDelete( pMan, pNode );
@@ -1481,6 +1489,45 @@ void Abc_AigUpdateReset( Abc_Aig_t * pMan )
     Vec_PtrClear( pMan->vUpdatedNets );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts recording the modified nodes.]
+
+  Description [After each replacement, the returned array contains the IDs
+  of the nodes that were recreated with new fanins and of the nodes that
+  were deleted. The client uses it to update the data computed for the
+  transitive fanout of these nodes (for example, the cuts) and clears it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Abc_AigModifiedStart( Abc_Aig_t * pMan )
+{
+    assert( pMan->vModified == NULL );
+    pMan->vModified = Vec_IntAlloc( 100 );
+    return pMan->vModified;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops recording the modified nodes.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_AigModifiedStop( Abc_Aig_t * pMan )
+{
+    assert( pMan->vModified != NULL );
+    Vec_IntFree( pMan->vModified );
+    pMan->vModified = NULL;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Start the update list.]
@@ -66,6 +66,7 @@
 #include "base/acb/acbPar.h"
 #include "misc/extra/extra.h"
 #include "opt/eslim/eSLIM.h"
+#include "misc/util/utilJson.h"
 
 
 #ifndef _WIN32
@@ -421,6 +422,7 @@ static int Abc_CommandAbc9Write              ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9WriteLut           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Ps                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9PFan               ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9HashStat           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Pms                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9PSig               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Status             ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -1241,6 +1243,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&wlut",         Abc_CommandAbc9WriteLut,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&ps",           Abc_CommandAbc9Ps,           0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&pfan",         Abc_CommandAbc9PFan,         0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&hashstat",     Abc_CommandAbc9HashStat,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&pms",          Abc_CommandAbc9Pms,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&psig",         Abc_CommandAbc9PSig,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&status",       Abc_CommandAbc9Status,       0 );
@@ -1565,6 +1568,8 @@ int Abc_CommandPrintStats( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fSkipBuf;
     int fSkipSmall;
     int fPrintMem;
+    Json_Wrt_t * pJson;
+    char * pJsonFile = NULL;
     int c;
 
     pNtk = Abc_FrameReadNtk(pAbc);
@@ -1582,10 +1587,19 @@ int Abc_CommandPrintStats( Abc_Frame_t * pAbc, int argc, char ** argv )
     fSkipSmall = 0;
     fPrintMem = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "fbdltmpgscuh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Jfbdltmpgscuh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pJsonFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'f':
             fFactor ^= 1;
             break;
@@ -1637,6 +1651,16 @@ int Abc_CommandPrintStats( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     Abc_NtkPrintStats( pNtk, fFactor, fSaveBest, fDumpResult, fUseLutLib, fPrintMuxes, fPower, fGlitch, fSkipBuf, fSkipSmall, fPrintMem );
+    if ( pJsonFile && (pJson = Json_WrtStart( pJsonFile, "print_stats" )) )
+    {
+        Abc_NtkPrintStatsJson( pNtk, pJson, fFactor, fUseLutLib, fPrintMuxes, fPower, fGlitch, fSkipBuf, fSkipSmall, fPrintMem );
+        if ( fPrintTime )
+        {
+            Json_WrtFloat( pJson, "elapse", pAbc->TimeCommand );
+            Json_WrtFloat( pJson, "total", pAbc->TimeTotal + pAbc->TimeCommand );
+        }
+        Json_WrtStop( pJson );
+    }
     if ( fPrintTime )
     {
         pAbc->TimeTotal += pAbc->TimeCommand;
@@ -1646,7 +1670,7 @@ int Abc_CommandPrintStats( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: print_stats [-fbdltmpgscuh]\n" );
+    Abc_Print( -2, "usage: print_stats [-fbdltmpgscuh] [-J file]\n" );
     Abc_Print( -2, "\t        prints the network statistics\n" );
     Abc_Print( -2, "\t-f    : toggles printing the literal count in the factored forms [default = %s]\n", fFactor? "yes": "no" );
     Abc_Print( -2, "\t-b    : toggles saving the best logic network in \"best.blif\" [default = %s]\n", fSaveBest? "yes": "no" );
@@ -1659,6 +1683,7 @@ usage:
     Abc_Print( -2, "\t-s    : toggles not counting single-output nodes as nodes [default = %s]\n", fSkipBuf? "yes": "no" );
     Abc_Print( -2, "\t-c    : toggles not counting constants and single-output nodes as nodes [default = %s]\n", fSkipSmall? "yes": "no" );
     Abc_Print( -2, "\t-u    : toggles printing memory usage [default = %s]\n", fPrintMem? "yes": "no" );
+    Abc_Print( -2, "\t-J    : file name to append the statistics in JSON format [default = none]\n" );
     Abc_Print( -2, "\t-h    : print the command usage\n");
     return 1;
 }
@@ -2665,19 +2690,31 @@ int Abc_CommandPrintGates( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fUseLibrary;
     int fUpdateProfile;
     int fVerbose;
+    Json_Wrt_t * pJson;
+    char * pJsonFile = NULL;
 
     extern void Abc_NtkPrintGates( Abc_Ntk_t * pNtk, int fUseLibrary, int fUpdateProfile );
     extern void Abc_NtkPrintGates2( Abc_Ntk_t * pNtk );
+    extern void Abc_NtkPrintGatesJson( Abc_Ntk_t * pNtk, void * pJson, int fUseLibrary );
 
     // set defaults
     fUseLibrary = 1;
     fUpdateProfile = 0;
     fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "luvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Jluvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pJsonFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'l':
             fUseLibrary ^= 1;
             break;
@@ -2708,14 +2745,20 @@ int Abc_CommandPrintGates( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_NtkPrintGates2( pNtk );
     else
         Abc_NtkPrintGates( pNtk, fUseLibrary, fUpdateProfile );
+    if ( pJsonFile && (pJson = Json_WrtStart( pJsonFile, "print_gates" )) )
+    {
+        Abc_NtkPrintGatesJson( pNtk, pJson, fUseLibrary );
+        Json_WrtStop( pJson );
+    }
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: print_gates [-luvh]\n" );
+    Abc_Print( -2, "usage: print_gates [-luvh] [-J file]\n" );
     Abc_Print( -2, "\t        prints statistics about gates used in the network\n" );
     Abc_Print( -2, "\t-l    : used library gate names (if mapped) [default = %s]\n", fUseLibrary? "yes": "no" );
     Abc_Print( -2, "\t-u    : update profile before printing it[default = %s]\n", fUpdateProfile? "yes": "no" );
     Abc_Print( -2, "\t-v    : enable verbose output [default = %s].\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-J    : file name to append the statistics in JSON format [default = none]\n" );
     Abc_Print( -2, "\t-h    : print the command usage\n");
     return 1;
 }
@@ -3933,6 +3976,7 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fSelective;
     int fUpdateLevel;
     int fExor;
+    int nProcs;
     int fVerbose;
     pNtk = Abc_FrameReadNtk(pAbc);
 
@@ -3941,12 +3985,24 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
     fSelective   = 0;
     fUpdateLevel = 1;
     fExor        = 0;
+    nProcs       = 0;
     fVerbose     = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "ldsxvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pldsxvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 0 || nProcs > 100 )
+                goto usage;
+            break;
         case 'l':
             fUpdateLevel ^= 1;
             break;
@@ -3980,7 +4036,7 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
         if ( fExor )
             pNtkRes = Abc_NtkBalanceExor( pNtk, fUpdateLevel, fVerbose );
         else
-            pNtkRes = Abc_NtkBalance( pNtk, fDuplicate, fSelective, fUpdateLevel );
+            pNtkRes = Abc_NtkBalancePar( pNtk, fDuplicate, fSelective, fUpdateLevel, nProcs );
     }
     else
     {
@@ -3993,7 +4049,7 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
         if ( fExor )
             pNtkRes = Abc_NtkBalanceExor( pNtkTemp, fUpdateLevel, fVerbose );
         else
-            pNtkRes = Abc_NtkBalance( pNtkTemp, fDuplicate, fSelective, fUpdateLevel );
+            pNtkRes = Abc_NtkBalancePar( pNtkTemp, fDuplicate, fSelective, fUpdateLevel, nProcs );
         Abc_NtkDelete( pNtkTemp );
     }
 
@@ -4008,8 +4064,9 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: balance [-ldsxvh]\n" );
+    Abc_Print( -2, "usage: balance [-P num] [-ldsxvh]\n" );
     Abc_Print( -2, "\t        transforms the current network into a well-balanced AIG\n" );
+    Abc_Print( -2, "\t-P num: the number of threads to collect supergates (0 <= num <= 100) [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-l    : toggle minimizing the number of levels [default = %s]\n", fUpdateLevel? "yes": "no" );
     Abc_Print( -2, "\t-d    : toggle duplication of logic [default = %s]\n", fDuplicate? "yes": "no" );
     Abc_Print( -2, "\t-s    : toggle duplication on the critical paths [default = %s]\n", fSelective? "yes": "no" );
@@ -16980,7 +17037,7 @@ int Abc_CommandDRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
     // set defaults
     Dar_ManDefaultRwrParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CNMflzrvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CNMPWflzrvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -17017,6 +17074,28 @@ int Abc_CommandDRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nMinSaved < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 0 || pPars->nProcs > 100 )
+                goto usage;
+            break;
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nWinSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nWinSize < 0 )
+                goto usage;
+            break;
         case 'f':
             pPars->fFanout ^= 1;
             break;
@@ -17066,12 +17145,18 @@ int Abc_CommandDRewrite( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: drw [-C num] [-NM num] [-lfzrvwh]\n" );
+    Abc_Print( -2, "usage: drw [-C num] [-NMPW num] [-lfzrvwh]\n" );
     Abc_Print( -2, "\t         performs combinational AIG rewriting\n" );
     Abc_Print( -2, "\t-C num : the max number of cuts at a node [default = %d]\n", pPars->nCutsMax );
     Abc_Print( -2, "\t-N num : the max number of subgraphs tried [default = %d]\n", pPars->nSubgMax );
     Abc_Print( -2, "\t-M num : the min number of nodes saved after one step (0 <= num) [default = %d]\n", pPars->nMinSaved );
+    Abc_Print( -2, "\t-P num : the number of threads rewriting windows concurrently (0 <= num <= 100) [default = %d]\n", pPars->nProcs );
+    Abc_Print( -2, "\t         (the windows are rewritten independently and the logic shared across\n" );
+    Abc_Print( -2, "\t         their boundaries is not seen, so the result is often a few percent larger)\n" );
+    Abc_Print( -2, "\t-W num : the number of nodes in one window (0 = automatic) [default = %d]\n", pPars->nWinSize );
     Abc_Print( -2, "\t-l     : toggle preserving the number of levels [default = %s]\n", pPars->fUpdateLevel? "yes": "no" );
+    Abc_Print( -2, "\t         (with -P, the levels are preserved only inside each window,\n" );
+    Abc_Print( -2, "\t         because the inputs of a window are treated as having level 0)\n" );
     Abc_Print( -2, "\t-f     : toggle representing fanouts [default = %s]\n", pPars->fFanout? "yes": "no" );
     Abc_Print( -2, "\t-z     : toggle using zero-cost replacements [default = %s]\n", pPars->fUseZeros? "yes": "no" );
     Abc_Print( -2, "\t-r     : toggle using cut recycling [default = %s]\n", pPars->fRecycle? "yes": "no" );
@@ -17413,7 +17498,7 @@ int Abc_CommandDch( Abc_Frame_t * pAbc, int argc, char ** argv )
     // set defaults
     Dch_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WCSsptgcfrxvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WCSPsptgcfrxvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -17450,6 +17535,17 @@ int Abc_CommandDch( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nSatVarMax < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 || pPars->nProcs > 100 )
+                goto usage;
+            break;
         case 's':
             pPars->fSynthesis ^= 1;
             break;
@@ -17504,11 +17600,15 @@ int Abc_CommandDch( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: dch [-WCS num] [-sptgcfrxvh]\n" );
+    Abc_Print( -2, "usage: dch [-WCSP num] [-sptgcfrxvh]\n" );
     Abc_Print( -2, "\t         computes structural choices using a new approach\n" );
     Abc_Print( -2, "\t-W num : the max number of simulation words [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-S num : the max number of SAT variables [default = %d]\n", pPars->nSatVarMax );
+    Abc_Print( -2, "\t-P num : the number of threads proving candidate equivalences (1 <= num <= 100) [default = %d]\n", pPars->nProcs );
+    Abc_Print( -2, "\t         (this is a throughput mode: the pairs of each level are proved before\n" );
+    Abc_Print( -2, "\t         the refinement, which roughly doubles the total SAT work, and the\n" );
+    Abc_Print( -2, "\t         choices differ from those computed without threads)\n" );
     Abc_Print( -2, "\t-s     : toggle synthesizing three snapshots [default = %s]\n", pPars->fSynthesis? "yes": "no" );
     Abc_Print( -2, "\t-p     : toggle power-aware rewriting [default = %s]\n", pPars->fPower? "yes": "no" );
     Abc_Print( -2, "\t-t     : toggle simulation of the TFO classes [default = %s]\n", pPars->fSimulateTfo? "yes": "no" );
@@ -33346,7 +33446,7 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
 
 usage:
     Abc_Print( -2, "usage: &r [-csxmnlvh] <file>\n" );
-    Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
+    Abc_Print( -2, "\t         reads the current AIG from the AIGER file (.gz and .bz2 are decompressed)\n" );
     Abc_Print( -2, "\t-c     : toggles reading simple AIG [default = %s]\n", fGiaSimple? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggles detecting XORs while reading [default = %s]\n", fDetectXors? "yes": "no" );
@@ -34507,7 +34607,7 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
 
 usage:
     Abc_Print( -2, "usage: &w [-upqicabmlnsvh] <file>\n" );
-    Abc_Print( -2, "\t         writes the current AIG into the AIGER file\n" );
+    Abc_Print( -2, "\t         writes the current AIG into the AIGER file (.gz and .bz2 are compressed)\n" );
     Abc_Print( -2, "\t-u     : toggle writing canonical AIG structure [default = %s]\n", fUnique? "yes" : "no" );
     Abc_Print( -2, "\t-p     : toggle writing Verilog with 'and' and 'not' [default = %s]\n", fVerilog? "yes" : "no" );
     Abc_Print( -2, "\t-q     : toggle writing Verilog with NAND-gates [default = %s]\n", fVerNand? "yes" : "no" );
@@ -34602,10 +34702,12 @@ usage:
 int Abc_CommandAbc9Ps( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Gps_Par_t Pars, * pPars = &Pars;
+    Json_Wrt_t * pJson;
+    char * pJsonFile = NULL;
     int c, fBest = 0;
     memset( pPars, 0, sizeof(Gps_Par_t) );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Dtpcnlmasozxbh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "DJtpcnlmasozxbh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -34651,6 +34753,15 @@ int Abc_CommandAbc9Ps( Abc_Frame_t * pAbc, int argc, char ** argv )
             pPars->pDumpFile = argv[globalUtilOptind];
             globalUtilOptind++;
             break;
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pJsonFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'b':
             fBest ^= 1;
             break;
@@ -34678,10 +34789,15 @@ int Abc_CommandAbc9Ps( Abc_Frame_t * pAbc, int argc, char ** argv )
         }
         Gia_ManPrintStats( pAbc->pGia, pPars );
     }
+    if ( pJsonFile && (pJson = Json_WrtStart( pJsonFile, "&ps" )) )
+    {
+        Gia_ManPrintStatsJson( fBest ? pAbc->pGiaBest : pAbc->pGia, pPars, pJson );
+        Json_WrtStop( pJson );
+    }
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &ps [-tpcnlmasozxbh] [-D file]\n" );
+    Abc_Print( -2, "usage: &ps [-tpcnlmasozxbh] [-D file] [-J file]\n" );
     Abc_Print( -2, "\t          prints stats of the current AIG\n" );
     Abc_Print( -2, "\t-t      : toggle printing BMC tents [default = %s]\n",                pPars->fTents? "yes": "no" );
     Abc_Print( -2, "\t-p      : toggle printing switching activity [default = %s]\n",       pPars->fSwitch? "yes": "no" );
@@ -34696,6 +34812,7 @@ usage:
     Abc_Print( -2, "\t-x      : toggle using no color in the printout [default = %s]\n",    pPars->fNoColor? "yes": "no" );
     Abc_Print( -2, "\t-b      : toggle printing saved AIG statistics [default = %s]\n",     fBest? "yes": "no" );
     Abc_Print( -2, "\t-D file : file name to dump statistics [default = none]\n" );
+    Abc_Print( -2, "\t-J file : file name to append statistics in JSON format [default = none]\n" );
     Abc_Print( -2, "\t-h      : print the command usage\n");
     return 1;
 }
@@ -34753,6 +34870,57 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9HashStat( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c, fReset = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "rh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'r':
+            fReset ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    Gia_ManHashStatsPrint( pAbc->pGia );
+    if ( fReset )
+    {
+        Gia_ManHashStatsReset();
+        if ( pAbc->pGia )
+        {
+            pAbc->pGia->nHashHit = pAbc->pGia->nHashMiss = pAbc->pGia->nHashLookup = pAbc->pGia->nHashProbe = 0;
+            pAbc->pGia->nHashProbeMax = pAbc->pGia->nHashResize = 0;
+            pAbc->pGia->timeHash = 0;
+        }
+    }
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &hashstat [-rh]\n" );
+    Abc_Print( -2, "\t         prints structural hashing statistics accumulated over the AIGs\n" );
+    Abc_Print( -2, "\t         derived since the start (or the last reset): hit rate, the number\n" );
+    Abc_Print( -2, "\t         of entries compared per lookup, resizes and rehashing time\n" );
+    Abc_Print( -2, "\t-r     : toggle resetting the statistics after printing [default = %s]\n", fReset? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -35548,8 +35716,10 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fStrMuxes  = 0;
     int fRehashMap = 0;
     int fInvert    = 0;
+    int nThreads   = 1;
+    int fVerbose   = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "LMbacmrsih" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "LMPbacmrsivh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -35575,6 +35745,17 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( Multi <= 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 || nThreads > 100 )
+                goto usage;
+            break;
         case 'b':
             fAddBuffs ^= 1;
             break;
@@ -35596,6 +35777,9 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'i':
             fInvert ^= 1;
             break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
         case 'h':
             goto usage;
         default:
@@ -35679,6 +35863,15 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         if ( !Abc_FrameReadFlag("silentmode") )
             printf( "Generated AIG from AND/XOR/MUX graph.\n" );
     }
+    else if ( nThreads > 1 && !fAddStrash && !Gia_ManBufNum(pAbc->pGia) )
+    {
+        pTemp = Gia_ManRehashPar( pAbc->pGia, nThreads, fVerbose );
+        if ( pTemp == NULL )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Strash(): Concurrent structural hashing has failed.\n" );
+            return 1;
+        }
+    }
     else
     {
         pTemp = Gia_ManRehash( pAbc->pGia, fAddStrash );
@@ -35695,7 +35888,7 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &st [-LM num] [-bacmrsih]\n" );
+    Abc_Print( -2, "usage: &st [-LMP num] [-bacmrsivh]\n" );
     Abc_Print( -2, "\t         performs structural hashing\n" );
     Abc_Print( -2, "\t-b     : toggle adding buffers at the inputs and outputs [default = %s]\n", fAddBuffs? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle additional hashing [default = %s]\n", fAddStrash? "yes": "no" );
@@ -35704,9 +35897,11 @@ usage:
     Abc_Print( -2, "\t-L num : create MUX when sum of refs does not exceed this limit [default = %d]\n", Limit );
     Abc_Print( -2, "\t         (use L = 1 to create AIG with XORs but without MUXes)\n" );
     Abc_Print( -2, "\t-M num : create an AIG with additional primary inputs [default = %d]\n", Multi );
+    Abc_Print( -2, "\t-P num : the number of threads used to rehash the AIG (1 <= num <= 100) [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-r     : toggle rehashing AIG while preserving mapping [default = %s]\n", fRehashMap? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle using MUX restructuring [default = %s]\n", fStrMuxes? "yes": "no" );
     Abc_Print( -2, "\t-i     : toggle complementing the POs of the AIG [default = %s]\n", fInvert? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
@@ -38828,6 +39023,7 @@ int Abc_CommandAbc9Balance( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Gia_Man_t * pTemp = NULL;
     int nNewNodesMax = ABC_INFINITY;
+    int nProcs       = 0;
     int fDelayOnly   = 0;
     int fSimpleAnd   = 0;
     int fStrict      = 0;
@@ -38835,10 +39031,21 @@ int Abc_CommandAbc9Balance( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c, fVerbose  = 0;
     int fVeryVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Ndaslvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NPdaslvwh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 0 || nProcs > 100 )
+                goto usage;
+            break;
         case 'N':
             if ( globalUtilOptind >= argc )
             {
@@ -38880,16 +39087,17 @@ int Abc_CommandAbc9Balance( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     if ( fDelayOnly )
-        pTemp = Gia_ManBalance( pAbc->pGia, fSimpleAnd, fStrict, fVerbose );
+        pTemp = Gia_ManBalancePar( pAbc->pGia, fSimpleAnd, fStrict, nProcs, fVerbose );
     else
-        pTemp = Gia_ManAreaBalance( pAbc->pGia, fSimpleAnd, nNewNodesMax, fVerbose, fVeryVerbose );
+        pTemp = Gia_ManAreaBalancePar( pAbc->pGia, fSimpleAnd, nNewNodesMax, nProcs, fVerbose, fVeryVerbose );
     Abc_FrameUpdateGia( pAbc, pTemp );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &b [-N num] [-dasvwh]\n" );
+    Abc_Print( -2, "usage: &b [-NP num] [-dasvwh]\n" );
     Abc_Print( -2, "\t         performs AIG balancing to reduce delay and area\n" );
     Abc_Print( -2, "\t-N num : the max fanout count to skip a divisor [default = %d]\n", nNewNodesMax );
+    Abc_Print( -2, "\t-P num : the number of threads to collect supergates (0 <= num <= 100) [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-d     : toggle delay only balancing [default = %s]\n", fDelayOnly? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle using AND instead of AND/XOR/MUX [default = %s]\n", fSimpleAnd? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle strict control of area in delay-mode (\"&b -d\") [default = %s]\n", fStrict? "yes": "no" );
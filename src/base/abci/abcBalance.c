@@ -27,13 +27,34 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
  
-static void        Abc_NtkBalancePerform( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkAig, int fDuplicate, int fSelective, int fUpdateLevel );
-static Abc_Obj_t * Abc_NodeBalance_rec( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNode, Vec_Vec_t * vStorage, int Level, int fDuplicate, int fSelective, int fUpdateLevel );
-static Vec_Ptr_t * Abc_NodeBalanceCone( Abc_Obj_t * pNode, Vec_Vec_t * vSuper, int Level, int fDuplicate, int fSelective );
-static int         Abc_NodeBalanceCone_rec( Abc_Obj_t * pNode, Vec_Ptr_t * vSuper, int fFirst, int fDuplicate, int fSelective );
+static void        Abc_NtkBalancePerform( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkAig, int fDuplicate, int fSelective, int fUpdateLevel, int nProcs );
+static Abc_Obj_t * Abc_NodeBalance_rec( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNode, Vec_Vec_t * vStorage, Vec_Vec_t * vSupers, int Level, int fDuplicate, int fSelective, int fUpdateLevel );
+static Vec_Ptr_t * Abc_NodeBalanceCone( Abc_Obj_t * pNode, Vec_Vec_t * vSuper, Vec_Vec_t * vSupers, int Level, int fDuplicate, int fSelective );
+static void        Abc_NodeBalanceConeInt( Abc_Obj_t * pNode, Vec_Ptr_t * vNodes, int fDuplicate, int fSelective, char * pMarks );
+static int         Abc_NodeBalanceCone_rec( Abc_Obj_t * pNode, Vec_Ptr_t * vSuper, int fFirst, int fDuplicate, int fSelective, char * pMarks );
+static Vec_Vec_t * Abc_NtkBalanceCollectPar( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, int nProcs );
 static void        Abc_NtkMarkCriticalNodes( Abc_Ntk_t * pNtk );
 static Vec_Ptr_t * Abc_NodeBalanceConeExor( Abc_Obj_t * pNode );
 
+// the visited nodes of a supergate are marked with fMarkB or in the private array of a thread
+static inline int  Abc_NodeBalanceIsMarked( Abc_Obj_t * pObj, char * pMarks )          { return pMarks ? pMarks[pObj->Id] : pObj->fMarkB;                       }
+static inline void Abc_NodeBalanceSetMark( Abc_Obj_t * pObj, char * pMarks, int Value ) { if ( pMarks ) pMarks[pObj->Id] = (char)Value; else pObj->fMarkB = Value; }
+
+#define ABC_BAL_PAR_MIN  1000   // the smallest wavefront divided among the threads
+
+typedef struct Abc_BalPar_t_ Abc_BalPar_t;
+struct Abc_BalPar_t_
+{
+    Vec_Vec_t *      vSupers;     // supergates by object ID
+    Vec_Ptr_t *      vRoots;      // the roots of the current wavefront
+    Vec_Ptr_t *      vNext;       // the roots of the next wavefront
+    char **          pMarks;      // the private marks of the visited nodes for each thread
+    int              nPerThread;  // the number of roots processed by one thread
+    int              nProcs;      // the number of threads
+    int              fDuplicate;  // duplication of logic
+    int              fSelective;  // duplication on the critical paths
+};
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -50,7 +71,7 @@ static Vec_Ptr_t * Abc_NodeBalanceConeExor( Abc_Obj_t * pNode );
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkBalance( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, int fUpdateLevel )
+Abc_Ntk_t * Abc_NtkBalancePar( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, int fUpdateLevel, int nProcs )
 {
 //    extern void Abc_NtkHaigTranfer( Abc_Ntk_t * pNtkOld, Abc_Ntk_t * pNtkNew );
     Abc_Ntk_t * pNtkAig;
@@ -66,7 +87,7 @@ Abc_Ntk_t * Abc_NtkBalance( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, in
     // transfer HAIG
 //    Abc_NtkHaigTranfer( pNtk, pNtkAig );
     // perform balancing
-    Abc_NtkBalancePerform( pNtk, pNtkAig, fDuplicate, fSelective, fUpdateLevel );
+    Abc_NtkBalancePerform( pNtk, pNtkAig, fDuplicate, fSelective, fUpdateLevel, nProcs );
     Abc_NtkFinalize( pNtk, pNtkAig );
     Abc_AigCleanup( (Abc_Aig_t *)pNtkAig->pManFunc );
     // undo the required times
@@ -87,6 +108,10 @@ Abc_Ntk_t * Abc_NtkBalance( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, in
 //Abc_NtkPrintCiLevels( pNtkAig );
     return pNtkAig;
 }
+Abc_Ntk_t * Abc_NtkBalance( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, int fUpdateLevel )
+{
+    return Abc_NtkBalancePar( pNtk, fDuplicate, fSelective, fUpdateLevel, 0 );
+}
 
 /**Function*************************************************************
 
@@ -99,10 +124,10 @@ Abc_Ntk_t * Abc_NtkBalance( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_NtkBalancePerform( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkAig, int fDuplicate, int fSelective, int fUpdateLevel )
+void Abc_NtkBalancePerform( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkAig, int fDuplicate, int fSelective, int fUpdateLevel, int nProcs )
 {
     ProgressBar * pProgress;
-    Vec_Vec_t * vStorage;
+    Vec_Vec_t * vStorage, * vSupers = NULL;
     Abc_Obj_t * pNode;
     int i;
     // transfer level
@@ -112,6 +137,9 @@ void Abc_NtkBalancePerform( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkAig, int fDuplicat
     Abc_NtkSetNodeLevelsArrival( pNtk );
     // allocate temporary storage for supergates
     vStorage = Vec_VecStart( 10 );
+    // collect the supergates concurrently
+    if ( nProcs > 1 )
+        vSupers = Abc_NtkBalanceCollectPar( pNtk, fDuplicate, fSelective, nProcs );
     // perform balancing of POs
     pProgress = Extra_ProgressBarStart( stdout, Abc_NtkCoNum(pNtk) );
     if ( pNtk->nBarBufs == 0 )
@@ -119,7 +147,7 @@ void Abc_NtkBalancePerform( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkAig, int fDuplicat
         Abc_NtkForEachCo( pNtk, pNode, i )
         {
             Extra_ProgressBarUpdate( pProgress, i, NULL );
-            Abc_NodeBalance_rec( pNtkAig, Abc_ObjFanin0(pNode), vStorage, 0, fDuplicate, fSelective, fUpdateLevel );
+            Abc_NodeBalance_rec( pNtkAig, Abc_ObjFanin0(pNode), vStorage, vSupers, 0, fDuplicate, fSelective, fUpdateLevel );
         }
     }
     else
@@ -127,13 +155,15 @@ void Abc_NtkBalancePerform( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkAig, int fDuplicat
         Abc_NtkForEachLiPo( pNtk, pNode, i )
         {
             Extra_ProgressBarUpdate( pProgress, i, NULL );
-            Abc_NodeBalance_rec( pNtkAig, Abc_ObjFanin0(pNode), vStorage, 0, fDuplicate, fSelective, fUpdateLevel );
+            Abc_NodeBalance_rec( pNtkAig, Abc_ObjFanin0(pNode), vStorage, vSupers, 0, fDuplicate, fSelective, fUpdateLevel );
             if ( i < pNtk->nBarBufs )
                 Abc_ObjFanout0(Abc_ObjFanout0(pNode))->Level = Abc_ObjFanin0(pNode)->Level;
         }
     }
     Extra_ProgressBarStop( pProgress );
     Vec_VecFree( vStorage );
+    if ( vSupers )
+        Vec_VecFree( vSupers );
 }
 
 /**Function*************************************************************
@@ -238,7 +268,7 @@ void Abc_NodeBalancePermute( Abc_Ntk_t * pNtkNew, Vec_Ptr_t * vSuper, int LeftBo
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Obj_t * Abc_NodeBalance_rec( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, Vec_Vec_t * vStorage, int Level, int fDuplicate, int fSelective, int fUpdateLevel )
+Abc_Obj_t * Abc_NodeBalance_rec( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, Vec_Vec_t * vStorage, Vec_Vec_t * vSupers, int Level, int fDuplicate, int fSelective, int fUpdateLevel )
 {
     Abc_Aig_t * pMan = (Abc_Aig_t *)pNtkNew->pManFunc;
     Abc_Obj_t * pNodeNew, * pNode1, * pNode2;
@@ -251,7 +281,7 @@ Abc_Obj_t * Abc_NodeBalance_rec( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, Vec_
     assert( Abc_ObjIsNode(pNodeOld) );
     // get the implication supergate
 //    Abc_NodeBalanceConeExor( pNodeOld );
-    vSuper = Abc_NodeBalanceCone( pNodeOld, vStorage, Level, fDuplicate, fSelective );
+    vSuper = Abc_NodeBalanceCone( pNodeOld, vStorage, vSupers, Level, fDuplicate, fSelective );
     if ( vSuper->nSize == 0 )
     { // it means that the supergate contains two nodes in the opposite polarity
         pNodeOld->pCopy = Abc_ObjNot(Abc_AigConst1(pNtkNew));
@@ -260,7 +290,7 @@ Abc_Obj_t * Abc_NodeBalance_rec( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, Vec_
     // for each old node, derive the new well-balanced node
     for ( i = 0; i < vSuper->nSize; i++ )
     {
-        pNodeNew = Abc_NodeBalance_rec( pNtkNew, Abc_ObjRegular((Abc_Obj_t *)vSuper->pArray[i]), vStorage, Level + 1, fDuplicate, fSelective, fUpdateLevel );
+        pNodeNew = Abc_NodeBalance_rec( pNtkNew, Abc_ObjRegular((Abc_Obj_t *)vSuper->pArray[i]), vStorage, vSupers, Level + 1, fDuplicate, fSelective, fUpdateLevel );
         vSuper->pArray[i] = Abc_ObjNotCond( pNodeNew, Abc_ObjIsComplement((Abc_Obj_t *)vSuper->pArray[i]) );
     }
     if ( vSuper->nSize < 2 )
@@ -304,10 +334,9 @@ Abc_Obj_t * Abc_NodeBalance_rec( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pNodeOld, Vec_
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Ptr_t * Abc_NodeBalanceCone( Abc_Obj_t * pNode, Vec_Vec_t * vStorage, int Level, int fDuplicate, int fSelective )
+Vec_Ptr_t * Abc_NodeBalanceCone( Abc_Obj_t * pNode, Vec_Vec_t * vStorage, Vec_Vec_t * vSupers, int Level, int fDuplicate, int fSelective )
 {
     Vec_Ptr_t * vNodes;
-    int RetValue, i;
     assert( !Abc_ObjIsComplement(pNode) );
     // extend the storage
     if ( Vec_VecSize( vStorage ) <= Level )
@@ -315,17 +344,30 @@ Vec_Ptr_t * Abc_NodeBalanceCone( Abc_Obj_t * pNode, Vec_Vec_t * vStorage, int Le
     // get the temporary array of nodes
     vNodes = Vec_VecEntry( vStorage, Level );
     Vec_PtrClear( vNodes );
+    // use the supergate collected in advance
+    if ( vSupers )
+    {
+        Vec_PtrAppend( vNodes, Vec_VecEntry(vSupers, pNode->Id) );
+        return vNodes;
+    }
     // collect the nodes in the implication supergate
-    RetValue = Abc_NodeBalanceCone_rec( pNode, vNodes, 1, fDuplicate, fSelective );
+    Abc_NodeBalanceConeInt( pNode, vNodes, fDuplicate, fSelective, NULL );
+    return vNodes;
+}
+void Abc_NodeBalanceConeInt( Abc_Obj_t * pNode, Vec_Ptr_t * vNodes, int fDuplicate, int fSelective, char * pMarks )
+{
+    int RetValue, i;
+    Vec_PtrClear( vNodes );
+    // collect the nodes in the implication supergate
+    RetValue = Abc_NodeBalanceCone_rec( pNode, vNodes, 1, fDuplicate, fSelective, pMarks );
     assert( vNodes->nSize > 1 );
     // unmark the visited nodes
     for ( i = 0; i < vNodes->nSize; i++ )
-        Abc_ObjRegular((Abc_Obj_t *)vNodes->pArray[i])->fMarkB = 0;
+        Abc_NodeBalanceSetMark( Abc_ObjRegular((Abc_Obj_t *)vNodes->pArray[i]), pMarks, 0 );
     // if we found the node and its complement in the same implication supergate, 
     // return empty set of nodes (meaning that we should use constant-0 node)
     if ( RetValue == -1 )
         vNodes->nSize = 0;
-    return vNodes;
 }
 
 
@@ -342,11 +384,11 @@ Vec_Ptr_t * Abc_NodeBalanceCone( Abc_Obj_t * pNode, Vec_Vec_t * vStorage, int Le
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NodeBalanceCone_rec( Abc_Obj_t * pNode, Vec_Ptr_t * vSuper, int fFirst, int fDuplicate, int fSelective )
+int Abc_NodeBalanceCone_rec( Abc_Obj_t * pNode, Vec_Ptr_t * vSuper, int fFirst, int fDuplicate, int fSelective, char * pMarks )
 {
     int RetValue1, RetValue2, i;
     // check if the node is visited
-    if ( Abc_ObjRegular(pNode)->fMarkB )
+    if ( Abc_NodeBalanceIsMarked(Abc_ObjRegular(pNode), pMarks) )
     {
         // check if the node occurs in the same polarity
         for ( i = 0; i < vSuper->nSize; i++ )
@@ -363,14 +405,14 @@ int Abc_NodeBalanceCone_rec( Abc_Obj_t * pNode, Vec_Ptr_t * vSuper, int fFirst,
     if ( !fFirst && (Abc_ObjIsComplement(pNode) || !Abc_ObjIsNode(pNode) || (!fDuplicate && !fSelective && (Abc_ObjFanoutNum(pNode) > 1)) || Vec_PtrSize(vSuper) > 10000) )
     {
         Vec_PtrPush( vSuper, pNode );
-        Abc_ObjRegular(pNode)->fMarkB = 1;
+        Abc_NodeBalanceSetMark( Abc_ObjRegular(pNode), pMarks, 1 );
         return 0;
     }
     assert( !Abc_ObjIsComplement(pNode) );
     assert( Abc_ObjIsNode(pNode) );
     // go through the branches
-    RetValue1 = Abc_NodeBalanceCone_rec( Abc_ObjChild0(pNode), vSuper, 0, fDuplicate, fSelective );
-    RetValue2 = Abc_NodeBalanceCone_rec( Abc_ObjChild1(pNode), vSuper, 0, fDuplicate, fSelective );
+    RetValue1 = Abc_NodeBalanceCone_rec( Abc_ObjChild0(pNode), vSuper, 0, fDuplicate, fSelective, pMarks );
+    RetValue2 = Abc_NodeBalanceCone_rec( Abc_ObjChild1(pNode), vSuper, 0, fDuplicate, fSelective, pMarks );
     if ( RetValue1 == -1 || RetValue2 == -1 )
         return -1;
     // return 1 if at least one branch has a duplicate
@@ -378,6 +420,89 @@ int Abc_NodeBalanceCone_rec( Abc_Obj_t * pNode, Vec_Ptr_t * vSuper, int fFirst,
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the supergates of the network in several threads.]
+
+  Description [The supergates are computed by wavefronts, starting from the
+  drivers of the COs.  The roots of a wavefront are divided among the
+  threads, which mark the visited nodes in their private arrays instead of
+  fMarkB, so that the network is only read.  The leaves of the supergates,
+  which were not seen before, become the roots of the next wavefront.
+  The threads are kept alive between the wavefronts.  Returns the array
+  of supergates indexed by object IDs.  Balancing uses them in the same
+  order as without threads, so the result is the same.]
+               
+  SideEffects [Uses the traversal IDs of the network.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_NtkBalanceCollectParSchedule( Abc_Obj_t * pNode, Vec_Ptr_t * vRoots )
+{
+    pNode = Abc_ObjRegular(pNode);
+    if ( pNode->pCopy || !Abc_ObjIsNode(pNode) )
+        return;
+    if ( Abc_NodeIsTravIdCurrent(pNode) )
+        return;
+    Abc_NodeSetTravIdCurrent( pNode );
+    Vec_PtrPush( vRoots, pNode );
+}
+static int Abc_NtkBalanceCollectParRound( void * pArg )
+{
+    Abc_BalPar_t * p = (Abc_BalPar_t *)pArg;
+    Abc_Obj_t * pNode, * pLeaf;
+    int i, k;
+    // the new leaves of the last wavefront become the next wavefront
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vRoots, pNode, i )
+        Vec_PtrForEachEntry( Abc_Obj_t *, Vec_VecEntry(p->vSupers, pNode->Id), pLeaf, k )
+            Abc_NtkBalanceCollectParSchedule( pLeaf, p->vNext );
+    ABC_SWAP( Vec_Ptr_t *, p->vRoots, p->vNext );
+    Vec_PtrClear( p->vNext );
+    // small wavefronts are not divided
+    if ( Vec_PtrSize(p->vRoots) < ABC_BAL_PAR_MIN )
+        p->nPerThread = Vec_PtrSize(p->vRoots);
+    else
+        p->nPerThread = (Vec_PtrSize(p->vRoots) + p->nProcs - 1) / p->nProcs;
+    return Vec_PtrSize(p->vRoots) > 0;
+}
+static void Abc_NtkBalanceCollectParThread( void * pArg, int iThread )
+{
+    Abc_BalPar_t * p = (Abc_BalPar_t *)pArg;
+    Abc_Obj_t * pNode;
+    int i, iBeg = iThread * p->nPerThread;
+    int iEnd = Abc_MinInt( iBeg + p->nPerThread, Vec_PtrSize(p->vRoots) );
+    Vec_PtrForEachEntryStartStop( Abc_Obj_t *, p->vRoots, pNode, i, iBeg, iEnd )
+        Abc_NodeBalanceConeInt( pNode, Vec_VecEntry(p->vSupers, pNode->Id), p->fDuplicate, p->fSelective, p->pMarks[iThread] );
+}
+Vec_Vec_t * Abc_NtkBalanceCollectPar( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, int nProcs )
+{
+    Abc_BalPar_t Par, * p = &Par;
+    Abc_Obj_t * pNode;
+    int i;
+    memset( p, 0, sizeof(Abc_BalPar_t) );
+    p->vSupers    = Vec_VecStart( Abc_NtkObjNumMax(pNtk) );
+    p->vRoots     = Vec_PtrAlloc( 1000 );
+    p->vNext      = Vec_PtrAlloc( 1000 );
+    p->pMarks     = ABC_CALLOC( char *, nProcs );
+    p->nProcs     = nProcs;
+    p->fDuplicate = fDuplicate;
+    p->fSelective = fSelective;
+    for ( i = 0; i < nProcs; i++ )
+        p->pMarks[i] = ABC_CALLOC( char, Abc_NtkObjNumMax(pNtk) );
+    // the first wavefront is made of the drivers of the COs
+    Abc_NtkIncrementTravId( pNtk );
+    Abc_NtkForEachCo( pNtk, pNode, i )
+        Abc_NtkBalanceCollectParSchedule( Abc_ObjFanin0(pNode), p->vNext );
+    Util_ProcessThreadsRounds( Abc_NtkBalanceCollectParRound, Abc_NtkBalanceCollectParThread, p, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+        ABC_FREE( p->pMarks[i] );
+    ABC_FREE( p->pMarks );
+    Vec_PtrFree( p->vRoots );
+    Vec_PtrFree( p->vNext );
+    return p->vSupers;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -471,7 +596,7 @@ Vec_Ptr_t * Abc_NodeFindCone_rec( Abc_Obj_t * pNode )
     else
     {
         // collect the nodes in the implication supergate
-        RetValue = Abc_NodeBalanceCone_rec( pNode, vNodes, 1, 1, 0 );
+        RetValue = Abc_NodeBalanceCone_rec( pNode, vNodes, 1, 1, 0, NULL );
         assert( vNodes->nSize > 1 );
         // unmark the visited nodes
         Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
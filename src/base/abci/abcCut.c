@@ -529,6 +529,60 @@ void Abc_NodeFreeCuts( void * p, Abc_Obj_t * pObj )
     Cut_NodeFreeCuts( (Cut_Man_t *)p, pObj->Id );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Frees the cuts in the transitive fanout of the node.]
+
+  Description [The traversal stops at the nodes without cuts because
+  the cuts are computed from the cuts of the fanins; so if a node has 
+  no cuts, its fanouts computed after it was last changed have none.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NodeFreeCutsTfo_rec( Cut_Man_t * p, Abc_Obj_t * pObj )
+{
+    Abc_Obj_t * pFanout;
+    int i;
+    if ( Cut_NodeReadCutsNew( p, pObj->Id ) == NULL )
+        return;
+    Cut_NodeFreeCuts( p, pObj->Id );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+        if ( Abc_ObjIsNode(pFanout) )
+            Abc_NodeFreeCutsTfo_rec( p, pFanout );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the cuts that were invalidated by the replacement.]
+
+  Description [Takes the IDs of the nodes recorded by the AIG manager
+  (see Abc_AigModifiedStart()) and frees the cuts of these nodes and of
+  their transitive fanout, which are recomputed on demand by 
+  Abc_NodeGetCutsRecursive(). Clears the array.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkFreeCutsModified( void * p, Abc_Ntk_t * pNtk, Vec_Int_t * vModified )
+{
+    Abc_Obj_t * pObj;
+    int i, Id;
+    Vec_IntForEachEntry( vModified, Id, i )
+    {
+        pObj = Abc_NtkObj( pNtk, Id );
+        if ( pObj == NULL ) // the node was deleted
+            Cut_NodeFreeCuts( (Cut_Man_t *)p, Id );
+        else
+            Abc_NodeFreeCutsTfo_rec( (Cut_Man_t *)p, pObj );
+    }
+    Vec_IntClear( vModified );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the cuts for the network.]
@@ -1564,7 +1564,13 @@ Abc_Ntk_t * Abc_NtkDRewrite( Abc_Ntk_t * pNtk, Dar_RwrPar_t * pPars )
         Vec_VecFree( vParts );
     }
 */
-    Dar_ManRewrite( pMan, pPars );
+    if ( pPars->nProcs > 1 )
+    {
+        pMan = Dar_ManRewritePar( pTemp = pMan, pPars );
+        Aig_ManStop( pTemp );
+    }
+    else
+        Dar_ManRewrite( pMan, pPars );
 //    pMan = Dar_ManBalance( pTemp = pMan, pPars->fUpdateLevel );
 //    Aig_ManStop( pTemp );
 
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include "base/abc/abc.h"
+#include "misc/util/utilTruth.h"
 #include "bool/dec/dec.h"
 #include "opt/rwr/rwr.h"
 #include "bool/kit/kit.h"
@@ -1027,8 +1028,8 @@ void Abc_ManResubPrintDivs( Abc_ManRes_t * p, Abc_Obj_t * pRoot, Vec_Ptr_t * vLe
 void Abc_ManResubSimulate( Vec_Ptr_t * vDivs, int nLeaves, Vec_Ptr_t * vSims, int nLeavesMax, int nWords )
 {
     Abc_Obj_t * pObj;
-    unsigned * puData0, * puData1, * puData;
-    int i, k;
+    unsigned * puData;
+    int i;
     assert( Vec_PtrSize(vDivs) - nLeaves <= Vec_PtrSize(vSims) - nLeavesMax );
     // simulate
     Vec_PtrForEachEntry( Abc_Obj_t *, vDivs, pObj, i )
@@ -1040,23 +1041,9 @@ void Abc_ManResubSimulate( Vec_Ptr_t * vDivs, int nLeaves, Vec_Ptr_t * vSims, in
         }
         // set storage for the node's simulation info
         pObj->pData = Vec_PtrEntry( vSims, i - nLeaves + nLeavesMax );
-        // get pointer to the simulation info
-        puData  = (unsigned *)pObj->pData;
-        puData0 = (unsigned *)Abc_ObjFanin0(pObj)->pData;
-        puData1 = (unsigned *)Abc_ObjFanin1(pObj)->pData;
         // simulate
-        if ( Abc_ObjFaninC0(pObj) && Abc_ObjFaninC1(pObj) )
-            for ( k = 0; k < nWords; k++ )
-                puData[k] = ~puData0[k] & ~puData1[k];
-        else if ( Abc_ObjFaninC0(pObj) )
-            for ( k = 0; k < nWords; k++ )
-                puData[k] = ~puData0[k] & puData1[k];
-        else if ( Abc_ObjFaninC1(pObj) )
-            for ( k = 0; k < nWords; k++ )
-                puData[k] = puData0[k] & ~puData1[k];
-        else 
-            for ( k = 0; k < nWords; k++ )
-                puData[k] = puData0[k] & puData1[k];
+        Abc_TtAndMasked( (unsigned *)pObj->pData, (unsigned *)Abc_ObjFanin0(pObj)->pData, (unsigned *)Abc_ObjFanin1(pObj)->pData, 
+            Abc_ObjFaninC0(pObj) ? ~0 : 0, Abc_ObjFaninC1(pObj) ? ~0 : 0, nWords );
     }
     // normalize
     Vec_PtrForEachEntry( Abc_Obj_t *, vDivs, pObj, i )
@@ -1064,8 +1051,7 @@ void Abc_ManResubSimulate( Vec_Ptr_t * vDivs, int nLeaves, Vec_Ptr_t * vSims, in
         puData = (unsigned *)pObj->pData;
         pObj->fPhase = (puData[0] & 1);
         if ( pObj->fPhase )
-            for ( k = 0; k < nWords; k++ )
-                puData[k] = ~puData[k];
+            Abc_TtAndMasked( puData, puData, puData, ~0, ~0, nWords );
     }
 }
 
@@ -1305,7 +1291,7 @@ void Abc_ManResubDivsS( Abc_ManRes_t * p, int Required )
     int fMoreDivs = 1; // bug fix by Siang-Yun Lee
     Abc_Obj_t * pObj;
     unsigned * puData, * puDataR;
-    int i, w;
+    int i;
     Vec_PtrClear( p->vDivs1UP );
     Vec_PtrClear( p->vDivs1UN );
     Vec_PtrClear( p->vDivs1B );
@@ -1317,48 +1303,30 @@ void Abc_ManResubDivsS( Abc_ManRes_t * p, int Required )
 
         puData = (unsigned *)pObj->pData;
         // check positive containment
-        for ( w = 0; w < p->nWords; w++ )
-//            if ( puData[w] & ~puDataR[w] )
-            if ( puData[w] & ~puDataR[w] & p->pCareSet[w] ) // care set
-                break;
-        if ( w == p->nWords )
+        // puData & ~puDataR & care set is empty
+        if ( Abc_TtAndMaskedIsZero( puData, puData, puDataR, p->pCareSet, 0, 0, 0, ~0, p->nWords ) )
         {
             Vec_PtrPush( p->vDivs1UP, pObj );
             continue;
         }
-        if ( fMoreDivs )
+        // ~puData & ~puDataR & care set is empty
+        if ( fMoreDivs && Abc_TtAndMaskedIsZero( puData, puData, puDataR, p->pCareSet, ~0, ~0, 0, ~0, p->nWords ) )
         {
-            for ( w = 0; w < p->nWords; w++ )
-    //            if ( ~puData[w] & ~puDataR[w] )
-                if ( ~puData[w] & ~puDataR[w] & p->pCareSet[w] ) // care set
-                    break;
-            if ( w == p->nWords )
-            {
-                Vec_PtrPush( p->vDivs1UP, Abc_ObjNot(pObj) );
-                continue;
-            }
+            Vec_PtrPush( p->vDivs1UP, Abc_ObjNot(pObj) );
+            continue;
         }
         // check negative containment
-        for ( w = 0; w < p->nWords; w++ )
-//            if ( ~puData[w] & puDataR[w] )
-            if ( ~puData[w] & puDataR[w] & p->pCareSet[w] ) // care set
-                break;
-        if ( w == p->nWords )
+        // ~puData & puDataR & care set is empty
+        if ( Abc_TtAndMaskedIsZero( puData, puData, puDataR, p->pCareSet, ~0, ~0, 0, 0, p->nWords ) )
         {
             Vec_PtrPush( p->vDivs1UN, pObj );
             continue;
         }
-        if ( fMoreDivs )
+        // puData & puDataR & care set is empty
+        if ( fMoreDivs && Abc_TtAndMaskedIsZero( puData, puData, puDataR, p->pCareSet, 0, 0, 0, 0, p->nWords ) )
         {
-            for ( w = 0; w < p->nWords; w++ )
-    //            if ( puData[w] & puDataR[w] )
-                if ( puData[w] & puDataR[w] & p->pCareSet[w] ) // care set
-                    break;
-            if ( w == p->nWords )
-            {
-                Vec_PtrPush( p->vDivs1UN, Abc_ObjNot(pObj) );
-                continue;
-            }
+            Vec_PtrPush( p->vDivs1UN, Abc_ObjNot(pObj) );
+            continue;
         }
         // add the node to binates
         Vec_PtrPush( p->vDivs1B, pObj );
@@ -1380,7 +1348,7 @@ void Abc_ManResubDivsD( Abc_ManRes_t * p, int Required )
 {
     Abc_Obj_t * pObj0, * pObj1;
     unsigned * puData0, * puData1, * puDataR;
-    int i, k, w;
+    int i, k;
     Vec_PtrClear( p->vDivs2UP0 );
     Vec_PtrClear( p->vDivs2UP1 );
     Vec_PtrClear( p->vDivs2UN0 );
@@ -1402,38 +1370,26 @@ void Abc_ManResubDivsD( Abc_ManRes_t * p, int Required )
             if ( Vec_PtrSize(p->vDivs2UP0) < ABC_RS_DIV2_MAX )
             {
                 // get positive unate divisors
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & puData1[w]) & ~puDataR[w] )
-                    if ( (puData0[w] & puData1[w]) & ~puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                // (puData0 & puData1) & ~puDataR & care set is empty
+                if ( Abc_TtAndMaskedIsZero( puData0, puData1, puDataR, p->pCareSet, 0, 0, 0, ~0, p->nWords ) )
                 {
                     Vec_PtrPush( p->vDivs2UP0, pObj0 );
                     Vec_PtrPush( p->vDivs2UP1, pObj1 );
                 }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (~puData0[w] & puData1[w]) & ~puDataR[w] )
-                    if ( (~puData0[w] & puData1[w]) & ~puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                // (~puData0 & puData1) & ~puDataR & care set is empty
+                if ( Abc_TtAndMaskedIsZero( puData0, puData1, puDataR, p->pCareSet, ~0, 0, 0, ~0, p->nWords ) )
                 {
                     Vec_PtrPush( p->vDivs2UP0, Abc_ObjNot(pObj0) );
                     Vec_PtrPush( p->vDivs2UP1, pObj1 );
                 }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & ~puData1[w]) & ~puDataR[w] )
-                    if ( (puData0[w] & ~puData1[w]) & ~puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                // (puData0 & ~puData1) & ~puDataR & care set is empty
+                if ( Abc_TtAndMaskedIsZero( puData0, puData1, puDataR, p->pCareSet, 0, ~0, 0, ~0, p->nWords ) )
                 {
                     Vec_PtrPush( p->vDivs2UP0, pObj0 );
                     Vec_PtrPush( p->vDivs2UP1, Abc_ObjNot(pObj1) );
                 }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] | puData1[w]) & ~puDataR[w] )
-                    if ( (puData0[w] | puData1[w]) & ~puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                // (puData0 | puData1) & ~puDataR & care set is empty
+                if ( Abc_TtAndMaskedIsZero( puData0, puData1, puDataR, p->pCareSet, ~0, ~0, ~0, ~0, p->nWords ) )
                 {
                     Vec_PtrPush( p->vDivs2UP0, Abc_ObjNot(pObj0) );
                     Vec_PtrPush( p->vDivs2UP1, Abc_ObjNot(pObj1) );
@@ -1443,38 +1399,26 @@ void Abc_ManResubDivsD( Abc_ManRes_t * p, int Required )
             if ( Vec_PtrSize(p->vDivs2UN0) < ABC_RS_DIV2_MAX )
             {
                 // get negative unate divisors
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ~(puData0[w] & puData1[w]) & puDataR[w] )
-                    if ( ~(puData0[w] & puData1[w]) & puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                // ~(puData0 & puData1) & puDataR & care set is empty
+                if ( Abc_TtAndMaskedIsZero( puData0, puData1, puDataR, p->pCareSet, 0, 0, ~0, 0, p->nWords ) )
                 {
                     Vec_PtrPush( p->vDivs2UN0, pObj0 );
                     Vec_PtrPush( p->vDivs2UN1, pObj1 );
                 }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ~(~puData0[w] & puData1[w]) & puDataR[w] )
-                    if ( ~(~puData0[w] & puData1[w]) & puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                // ~(~puData0 & puData1) & puDataR & care set is empty
+                if ( Abc_TtAndMaskedIsZero( puData0, puData1, puDataR, p->pCareSet, ~0, 0, ~0, 0, p->nWords ) )
                 {
                     Vec_PtrPush( p->vDivs2UN0, Abc_ObjNot(pObj0) );
                     Vec_PtrPush( p->vDivs2UN1, pObj1 );
                 }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ~(puData0[w] & ~puData1[w]) & puDataR[w] )
-                    if ( ~(puData0[w] & ~puData1[w]) & puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                // ~(puData0 & ~puData1) & puDataR & care set is empty
+                if ( Abc_TtAndMaskedIsZero( puData0, puData1, puDataR, p->pCareSet, 0, ~0, ~0, 0, p->nWords ) )
                 {
                     Vec_PtrPush( p->vDivs2UN0, pObj0 );
                     Vec_PtrPush( p->vDivs2UN1, Abc_ObjNot(pObj1) );
                 }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ~(puData0[w] | puData1[w]) & puDataR[w] )
-                    if ( ~(puData0[w] | puData1[w]) & puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                // ~(puData0 | puData1) & puDataR & care set is empty
+                if ( Abc_TtAndMaskedIsZero( puData0, puData1, puDataR, p->pCareSet, ~0, ~0, 0, 0, p->nWords ) )
                 {
                     Vec_PtrPush( p->vDivs2UN0, Abc_ObjNot(pObj0) );
                     Vec_PtrPush( p->vDivs2UN1, Abc_ObjNot(pObj1) );
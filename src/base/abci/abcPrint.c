@@ -22,6 +22,7 @@
 #include "base/abc/abc.h"
 #include "bool/dec/dec.h"
 #include "base/main/main.h"
+#include "misc/util/utilJson.h"
 #include "map/mio/mio.h"
 #include "aig/aig/aig.h"
 #include "map/if/if.h"
@@ -485,6 +486,108 @@ void Abc_NtkPrintStats( Abc_Ntk_t * pNtk, int fFactored, int fSaveBest, int fDum
         Abc_NtkPrintStats( pNtk->pExdc, fFactored, fSaveBest, fDumpResult, fUseLutLib, fPrintMuxes, fPower, fGlitch, fSkipBuf, fSkipSmall, fPrintMem );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes the network statistics into the JSON record.]
+
+  Description [Writes the metrics printed by Abc_NtkPrintStats() with the
+  same options.  The statistics of the EXDC network are written into the
+  nested object "exdc".]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkPrintStatsJson( Abc_Ntk_t * pNtk, void * pJson, int fFactored, int fUseLutLib, int fPrintMuxes, int fPower, int fGlitch, int fSkipBuf, int fSkipSmall, int fPrintMem )
+{
+    Json_Wrt_t * p = (Json_Wrt_t *)pJson;
+    int nSingles = fSkipBuf ? Abc_NtkGetBufNum(pNtk) : 0;
+    Json_WrtStr( p, "name", pNtk->pName );
+    if ( fPrintMuxes && Abc_NtkIsStrash(pNtk) )
+    {
+        extern int Abc_NtkCountMuxes( Abc_Ntk_t * pNtk );
+        int nXors = Abc_NtkGetExorNum(pNtk);
+        int nMuxs = Abc_NtkCountMuxes(pNtk) - nXors;
+        int nAnds = Abc_NtkNodeNum(pNtk) - (nMuxs + nXors) * 3 - nSingles;
+        Json_WrtInt( p, "xors", nXors );
+        Json_WrtInt( p, "muxes", nMuxs );
+        Json_WrtInt( p, "ands", nAnds );
+        Json_WrtInt( p, "total", nAnds + nXors + nMuxs );
+        return;
+    }
+    Json_WrtStr( p, "type", Abc_NtkIsNetlist(pNtk) ? "netlist" : Abc_NtkIsStrash(pNtk) ? "strash" : Abc_NtkIsLogic(pNtk) ? "logic" : "other" );
+    Json_WrtInt( p, "pis", Abc_NtkPiNum(pNtk) );
+    Json_WrtInt( p, "pos", Abc_NtkPoNum(pNtk) );
+    Json_WrtInt( p, "constraints", Abc_NtkConstrNum(pNtk) );
+    Json_WrtInt( p, "latches", Abc_NtkLatchNum(pNtk) );
+    Json_WrtInt( p, "barbufs", pNtk->nBarBufs );
+    if ( Abc_NtkIsNetlist(pNtk) )
+    {
+        Json_WrtInt( p, "nets", Abc_NtkNetNum(pNtk) );
+        Json_WrtInt( p, "nodes", fSkipSmall ? Abc_NtkGetLargeNodeNum(pNtk) : Abc_NtkNodeNum(pNtk) - nSingles );
+        Json_WrtInt( p, "whiteboxes", Abc_NtkWhiteboxNum(pNtk) );
+        Json_WrtInt( p, "blackboxes", Abc_NtkBlackboxNum(pNtk) );
+    }
+    else if ( Abc_NtkIsStrash(pNtk) )
+    {
+        Json_WrtInt( p, "ands", Abc_NtkNodeNum(pNtk) );
+        Json_WrtInt( p, "choices", Abc_NtkGetChoiceNum(pNtk) );
+    }
+    else
+    {
+        Json_WrtInt( p, "nodes", fSkipSmall ? Abc_NtkGetLargeNodeNum(pNtk) : Abc_NtkNodeNum(pNtk) - nSingles );
+        Json_WrtInt( p, "edges", Abc_NtkGetTotalFanins(pNtk) - nSingles );
+    }
+    if ( Abc_NtkIsStrash(pNtk) || Abc_NtkIsNetlist(pNtk) )
+    {
+    }
+    else if ( Abc_NtkHasSop(pNtk) )
+    {
+        Json_WrtInt( p, "cubes", Abc_NtkGetCubeNum(pNtk) - nSingles );
+        if ( fFactored )
+        {
+            Json_WrtInt( p, "lits_sop", Abc_NtkGetLitNum(pNtk) - nSingles );
+            Json_WrtInt( p, "lits_fac", Abc_NtkGetLitFactNum(pNtk) - nSingles );
+        }
+    }
+    else if ( Abc_NtkHasAig(pNtk) )
+        Json_WrtInt( p, "aig_nodes", Abc_NtkGetAigNodeNum(pNtk) - nSingles );
+    else if ( Abc_NtkHasBdd(pNtk) )
+        Json_WrtInt( p, "bdd_nodes", Abc_NtkGetBddNodeNum(pNtk) - nSingles );
+    else if ( Abc_NtkHasMapping(pNtk) )
+    {
+        int fHasTimeMan = (int)(pNtk->pManTime != NULL);
+        Json_WrtFloat( p, "area", Abc_NtkGetMappedArea(pNtk) );
+        Json_WrtFloat( p, "delay", Abc_NtkDelayTrace(pNtk, NULL, NULL, 0) );
+        if ( !fHasTimeMan && pNtk->pManTime )
+        {
+            Abc_ManTimeStop( pNtk->pManTime );
+            pNtk->pManTime = NULL;
+        }
+    }
+    Json_WrtInt( p, "levels", Abc_NtkIsStrash(pNtk) ? Abc_AigLevel(pNtk) : Abc_NtkLevel(pNtk) );
+    if ( pNtk->nBarBufs2 )
+        Json_WrtInt( p, "buffers", pNtk->nBarBufs2 );
+    if ( fUseLutLib && Abc_FrameReadLibLut() )
+    {
+        Json_WrtFloat( p, "lut_delay", Abc_NtkDelayTraceLut(pNtk, 1) );
+        Json_WrtFloat( p, "lut_area", Abc_NtkGetArea(pNtk) );
+    }
+    if ( fPower )
+        Json_WrtFloat( p, "power", Abc_NtkMfsTotalSwitching(pNtk) );
+    if ( fGlitch && Abc_NtkIsLogic(pNtk) && Abc_NtkGetFaninMax(pNtk) <= 6 )
+        Json_WrtFloat( p, "glitch", Abc_NtkMfsTotalGlitching(pNtk, 4000, 8, 0) );
+    if ( fPrintMem )
+        Json_WrtFloat( p, "mem_mb", Abc_NtkMemory(pNtk)/(1<<20) );
+    if ( pNtk->pExdc )
+    {
+        Json_WrtObjStart( p, "exdc" );
+        Abc_NtkPrintStatsJson( pNtk->pExdc, pJson, fFactored, fUseLutLib, fPrintMuxes, fPower, fGlitch, fSkipBuf, fSkipSmall, fPrintMem );
+        Json_WrtObjStop( p );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Prints PIs/POs and LIs/LOs.]
@@ -1548,6 +1651,124 @@ void Abc_NtkPrintGates( Abc_Ntk_t * pNtk, int fUseLibrary, int fUpdateProfile )
     if ( fHasBdds )
         Abc_NtkSopToBdd(pNtk);
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Writes statistics about gates used in the network into the JSON record.]
+
+  Description [Writes the metrics printed by Abc_NtkPrintGates().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkPrintGatesJson( Abc_Ntk_t * pNtk, void * pJson, int fUseLibrary )
+{
+    Json_Wrt_t * p = (Json_Wrt_t *)pJson;
+    Abc_Obj_t * pObj;
+    int fHasBdds, i;
+    int Counts[6] = {0}, CounterTotal = 0, TotalDiff = 0;
+    char * pSop;
+
+    Json_WrtStr( p, "name", pNtk->pName );
+    if ( fUseLibrary && Abc_NtkHasMapping(pNtk) )
+    {
+        Mio_Gate_t ** ppGates;
+        double Area, AreaTotal;
+        int Counter, nGates;
+
+        // count the gates by name
+        nGates = Mio_LibraryReadGateNum( (Mio_Library_t *)pNtk->pManFunc );
+        ppGates = Mio_LibraryReadGateArray( (Mio_Library_t *)pNtk->pManFunc );
+        for ( i = 0; i < nGates; i++ )
+            Mio_GateSetValue( ppGates[i], 0 );
+        Abc_NtkForEachNodeNotBarBuf( pNtk, pObj, i )
+        {
+            if ( i == 0 ) continue;
+            Mio_GateSetValue( (Mio_Gate_t *)pObj->pData, 1 + Mio_GateReadValue((Mio_Gate_t *)pObj->pData) );
+            CounterTotal++;
+            // assuming that twin gates follow each other
+            if ( Abc_NtkFetchTwinNode(pObj) )
+                i++;
+        }
+
+        // write the gates
+        AreaTotal = Abc_NtkGetMappedArea(pNtk);
+        Json_WrtArrStart( p, "gates" );
+        for ( i = 0; i < nGates; i++ )
+        {
+            Counter = Mio_GateReadValue( ppGates[i] );
+            if ( Counter == 0 && Mio_GateReadProfile(ppGates[i]) == 0 )
+                continue;
+            if ( Mio_GateReadPinNum(ppGates[i]) > 1 )
+                TotalDiff += Abc_AbsInt( Mio_GateReadProfile(ppGates[i]) - Mio_GateReadProfile2(ppGates[i]) );
+            Area = Counter * Mio_GateReadArea( ppGates[i] );
+            Json_WrtObjStart( p, NULL );
+            Json_WrtStr( p, "gate", Mio_GateReadName(ppGates[i]) );
+            Json_WrtInt( p, "fanins", Mio_GateReadPinNum(ppGates[i]) );
+            Json_WrtInt( p, "instances", Counter );
+            Json_WrtFloat( p, "area", Area );
+            Json_WrtFloat( p, "area_percent", AreaTotal ? 100.0 * Area / AreaTotal : 0 );
+            Json_WrtInt( p, "profile", Mio_GateReadProfile(ppGates[i]) );
+            Json_WrtInt( p, "profile2", Mio_GateReadProfile2(ppGates[i]) );
+            Json_WrtStr( p, "function", Mio_GateReadForm(ppGates[i]) );
+            Json_WrtObjStop( p );
+        }
+        Json_WrtArrStop( p );
+        Json_WrtInt( p, "instances", CounterTotal );
+        Json_WrtFloat( p, "area", AreaTotal );
+        Json_WrtInt( p, "profile_diff", TotalDiff );
+        return;
+    }
+
+    if ( Abc_NtkIsAigLogic(pNtk) )
+        return;
+
+    // transform logic functions from BDD to SOP
+    if ( (fHasBdds = Abc_NtkIsBddLogic(pNtk)) )
+    {
+        if ( !Abc_NtkBddToSop(pNtk, -1, ABC_INFINITY, 1) )
+            return;
+    }
+
+    // get hold of the SOP of the node
+    Abc_NtkForEachNodeNotBarBuf( pNtk, pObj, i )
+    {
+        if ( i == 0 ) continue;
+        if ( Abc_NtkHasMapping(pNtk) )
+            pSop = Mio_GateReadSop((Mio_Gate_t *)pObj->pData);
+        else
+            pSop = (char *)pObj->pData;
+        // collect the stats
+        if ( Abc_SopIsConst0(pSop) || Abc_SopIsConst1(pSop) )
+            Counts[0]++;
+        else if ( Abc_SopIsBuf(pSop) )
+            Counts[1]++;
+        else if ( Abc_SopIsInv(pSop) )
+            Counts[2]++;
+        else if ( (!Abc_SopIsComplement(pSop) && Abc_SopIsAndType(pSop)) ||
+                  ( Abc_SopIsComplement(pSop) && Abc_SopIsOrType(pSop)) )
+            Counts[3]++;
+        else if ( ( Abc_SopIsComplement(pSop) && Abc_SopIsAndType(pSop)) ||
+                  (!Abc_SopIsComplement(pSop) && Abc_SopIsOrType(pSop)) )
+            Counts[4]++;
+        else
+            Counts[5]++;
+        CounterTotal++;
+    }
+    Json_WrtInt( p, "const",    Counts[0] );
+    Json_WrtInt( p, "buffer",   Counts[1] );
+    Json_WrtInt( p, "inverter", Counts[2] );
+    Json_WrtInt( p, "and",      Counts[3] );
+    Json_WrtInt( p, "or",       Counts[4] );
+    Json_WrtInt( p, "other",    Counts[5] );
+    Json_WrtInt( p, "total",    CounterTotal );
+
+    // convert the network back into BDDs if this is how it was
+    if ( fHasBdds )
+        Abc_NtkSopToBdd(pNtk);
+}
 void Abc_NtkPrintGates2( Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pNode; int n, nFaninMax = Abc_NtkGetFaninMax(pNtk);
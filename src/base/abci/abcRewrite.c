@@ -67,6 +67,7 @@ int Abc_NtkRewrite( Abc_Ntk_t * pNtk, int fUpdateLevel, int fUseZeros, int fVerb
     Abc_Obj_t * pNode;
 //    Vec_Ptr_t * vAddedCells = NULL, * vUpdatedNets = NULL;
     Dec_Graph_t * pGraph;
+    Vec_Int_t * vModified;
     int i, nNodes, nGain, fCompl, RetValue = 1;
     abctime clk, clkStart = Abc_Clock();
 
@@ -100,6 +101,8 @@ clk = Abc_Clock();
     pManCut = Abc_NtkStartCutManForRewrite( pNtk );
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCut;
+    // record the nodes changed by the replacements to keep the cuts up to date
+    vModified = Abc_AigModifiedStart( (Abc_Aig_t *)pNtk->pManFunc );
 
     if ( fVeryVerbose )
         Rwr_ScoresClean( pManRwr );
@@ -143,6 +146,8 @@ clk = Abc_Clock();
             RetValue = -1;
             break;
         }
+        // free the cuts of the changed nodes and their transitive fanout
+        Abc_NtkFreeCutsModified( pManCut, pNtk, vModified );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 
@@ -161,6 +166,7 @@ Rwr_ManAddTimeTotal( pManRwr, Abc_Clock() - clkStart );
         Rwr_ScoresReport( pManRwr );
     // delete the managers
     Rwr_ManStop( pManRwr );
+    Abc_AigModifiedStop( (Abc_Aig_t *)pNtk->pManFunc );
     Cut_ManStop( pManCut );
     pNtk->pManCut = NULL;
 
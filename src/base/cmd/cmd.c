@@ -37,6 +37,7 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static int CmdCommandTime          ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandProfile       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandSleep         ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandEcho          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandQuit          ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -51,6 +52,8 @@ static int CmdCommandUnsetVariable ( Abc_Frame_t * pAbc, int argc, char ** argv
 static int CmdCommandUndo          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandRecall        ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandEmpty         ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandSaveSession   ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandLoadSession   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 #if defined(WIN32)
 static int CmdCommandScanDir       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandRenameFiles   ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -91,6 +94,7 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     Cmd_HistoryRead( pAbc );
 
     Cmd_CommandAdd( pAbc, "Basic", "time",          CmdCommandTime,            0 );
+    Cmd_CommandAdd( pAbc, "Basic", "profile",       CmdCommandProfile,         0 );
     Cmd_CommandAdd( pAbc, "Basic", "sleep",         CmdCommandSleep,           0 );
     Cmd_CommandAdd( pAbc, "Basic", "echo",          CmdCommandEcho,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "quit",          CmdCommandQuit,            0 );
@@ -105,6 +109,8 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Basic", "undo",          CmdCommandUndo,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "recall",        CmdCommandRecall,          0 );
     Cmd_CommandAdd( pAbc, "Basic", "empty",         CmdCommandEmpty,           0 );
+    Cmd_CommandAdd( pAbc, "Basic", "save_session",  CmdCommandSaveSession,     0 );
+    Cmd_CommandAdd( pAbc, "Basic", "load_session",  CmdCommandLoadSession,     0 );
 #if defined(WIN32)
     Cmd_CommandAdd( pAbc, "Basic", "scandir",       CmdCommandScanDir,         0 );
     Cmd_CommandAdd( pAbc, "Basic", "renamefiles",   CmdCommandRenameFiles,     0 );
@@ -142,6 +148,11 @@ void Cmd_End( Abc_Frame_t * pAbc )
     char * pKey, * pValue;
     Cmd_HistoryWrite( pAbc, ABC_INFINITY );
 
+    if ( pAbc->fProfile && pAbc->vProfile && Vec_PtrSize(pAbc->vProfile) > pAbc->nProfReported )
+        Cmd_ProfReport( pAbc, pAbc->pProfFile );
+    Cmd_ProfClean( pAbc );
+    ABC_FREE( pAbc->pProfFile );
+
 //    st__free_table( pAbc->tCommands, (void (*)()) 0, CmdCommandFree );
 //    st__free_table( pAbc->tAliases,  (void (*)()) 0, CmdCommandAliasFree );
 //    st__free_table( pAbc->tFlags,    free, free );
@@ -230,6 +241,84 @@ int CmdCommandTime( Abc_Frame_t * pAbc, int argc, char **argv )
     return 1;
 }
 
+/**Function********************************************************************
+
+  Synopsis    [Controls profiling of the commands.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int CmdCommandProfile( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    char * pFileName = NULL;
+    int c;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Jh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( pAbc->Err, "Command line switch \"-J\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileName = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+
+    if ( !strcmp( argv[globalUtilOptind], "on" ) )
+    {
+        pAbc->fProfile = 1;
+        if ( pFileName )
+        {
+            ABC_FREE( pAbc->pProfFile );
+            pAbc->pProfFile = Abc_UtilStrsav( pFileName );
+        }
+    }
+    else if ( !strcmp( argv[globalUtilOptind], "off" ) )
+        pAbc->fProfile = 0;
+    else if ( !strcmp( argv[globalUtilOptind], "report" ) )
+        Cmd_ProfReport( pAbc, pFileName ? pFileName : pAbc->pProfFile );
+    else if ( !strcmp( argv[globalUtilOptind], "clear" ) )
+    {
+        if ( pAbc->nProfLevel > 0 )
+        {
+            fprintf( pAbc->Err, "The profile cannot be cleared by a command that is being profiled.\n" );
+            return 1;
+        }
+        Cmd_ProfClean( pAbc );
+    }
+    else
+        goto usage;
+    return 0;
+
+  usage:
+    fprintf( pAbc->Err, "usage: profile [-J file] [-h] <on|off|report|clear>\n" );
+    fprintf( pAbc->Err, "      \t\trecords the runtime, the peak memory and the network size\n" );
+    fprintf( pAbc->Err, "      \t\tbefore and after each command executed while profiling is on\n" );
+    fprintf( pAbc->Err, "      \t\t  on     : start profiling (new records are reported on exit)\n" );
+    fprintf( pAbc->Err, "      \t\t  off    : stop profiling\n" );
+    fprintf( pAbc->Err, "      \t\t  report : print the commands sorted by runtime\n" );
+    fprintf( pAbc->Err, "      \t\t  clear  : delete the collected profile\n" );
+    fprintf( pAbc->Err, "   -J \t\tthe file to append the profile in JSON [default = %s]\n", pAbc->pProfFile ? pAbc->pProfFile : "none" );
+    fprintf( pAbc->Err, "   -h \t\tprint the command usage\n" );
+    return 1;
+}
+
 /**Function********************************************************************
 
   Synopsis    []
@@ -1165,6 +1254,102 @@ usage:
     return 1;
 }
 
+/**Function********************************************************************
+
+  Synopsis    [Saves the state of the framework.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int CmdCommandSaveSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    abctime clk = Abc_Clock();
+    int c, fVerbose = 0;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    if ( !Abc_FrameSaveSession( pAbc, argv[globalUtilOptind] ) )
+        return 1;
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Saving session", Abc_Clock() - clk );
+    return 0;
+usage:
+
+    fprintf( pAbc->Err, "usage: save_session [-vh] <file>\n" );
+    fprintf( pAbc->Err, "         saves the networks, the AIGs, the libraries and the variables\n" );
+    fprintf( pAbc->Err, "         of the current session into a binary file\n" );
+    fprintf( pAbc->Err, "   -v :  toggle printing runtime [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "   -h :  print the command usage\n");
+    fprintf( pAbc->Err, "<file> : the session file to write\n");
+    return 1;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Restores the state of the framework.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int CmdCommandLoadSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    abctime clk = Abc_Clock();
+    int c, fVerbose = 0;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    if ( !Abc_FrameLoadSession( pAbc, argv[globalUtilOptind] ) )
+        return 1;
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Loading session", Abc_Clock() - clk );
+    return 0;
+usage:
+
+    fprintf( pAbc->Err, "usage: load_session [-vh] <file>\n" );
+    fprintf( pAbc->Err, "         replaces the networks, the AIGs, the libraries and the variables\n" );
+    fprintf( pAbc->Err, "         of the current session by those saved by \"save_session\"\n" );
+    fprintf( pAbc->Err, "   -v :  toggle printing runtime [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "   -h :  print the command usage\n");
+    fprintf( pAbc->Err, "<file> : the session file to read\n");
+    return 1;
+}
+
 
 #if 0
 
@@ -68,6 +68,11 @@ extern void       CmdCommandAliasAdd( Abc_Frame_t * pAbc, char * sName, int argc
 extern void       CmdCommandAliasPrint( Abc_Frame_t * pAbc, Abc_Alias * pAlias );
 extern char *     CmdCommandAliasLookup( Abc_Frame_t * pAbc, char * sCommand );
 extern void       CmdCommandAliasFree( Abc_Alias * p );
+/*=== cmdProf.c =======================================================*/
+extern void *     Cmd_ProfStart( Abc_Frame_t * pAbc, int argc, char ** argv );
+extern void       Cmd_ProfStop( Abc_Frame_t * pAbc, void * pProf );
+extern void       Cmd_ProfReport( Abc_Frame_t * pAbc, char * pFileName );
+extern void       Cmd_ProfClean( Abc_Frame_t * pAbc );
 /*=== cmdUtils.c =======================================================*/
 extern int        CmdCommandDispatch( Abc_Frame_t * pAbc, int * argc, char *** argv );
 extern const char *     CmdSplitLine( Abc_Frame_t * pAbc, const char * sCommand, int * argc, char *** argv );
@@ -0,0 +1,429 @@
+/**CFile****************************************************************
+
+  FileName    [cmdProf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Profiling of the dispatched commands.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include <time.h>
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+#include "misc/util/utilJson.h"
+#include "cmdInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the size of the networks in the framework
+typedef struct Cmd_ProfNtk_t_ Cmd_ProfNtk_t;
+struct Cmd_ProfNtk_t_
+{
+    int             nNodes;        // the number of nodes of the current network (-1 if none)
+    int             nLevels;       // the number of levels of the current network
+    double          Area;          // the area if the network is mapped (-1 otherwise)
+    double          Delay;         // the delay if the network is mapped (-1 otherwise)
+    int             nGiaAnds;      // the number of AND nodes of the &-space AIG (-1 if none)
+    int             nGiaLevels;    // the number of levels of the &-space AIG
+};
+
+// the record of one command
+typedef struct Cmd_Prof_t_ Cmd_Prof_t;
+struct Cmd_Prof_t_
+{
+    char *          pCommand;      // the command line
+    int             Id;            // the order of the command
+    int             Level;         // the nesting level (commands called from "source", aliases, etc)
+    double          TimeWall;      // the elapsed time
+    double          TimeCpu;       // the processor time
+    double          MemPeak;       // the peak resident memory while the command is running (MB)
+    int             fDone;         // the command is finished
+    Cmd_ProfNtk_t   Before;        // the networks before the command
+    Cmd_ProfNtk_t   After;         // the networks after the command
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the peak resident memory of the running commands.]
+
+  Description [Reads the peak resident memory of the process since the
+  last update, adds it to the commands that are still running, and resets
+  the peak to the current resident memory, so that each command gets the
+  peak reached while it was running.  The peak is available only on Linux;
+  on other systems the memory is reported as 0.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ProfUpdatePeak( Abc_Frame_t * pAbc )
+{
+#ifdef __linux__
+    Cmd_Prof_t * p;
+    char Buffer[256];
+    double Peak = 0;
+    int i;
+    FILE * pFile = fopen( "/proc/self/status", "r" );
+    if ( pFile == NULL )
+        return;
+    while ( fgets( Buffer, sizeof(Buffer), pFile ) )
+        if ( !strncmp( Buffer, "VmHWM:", 6 ) )
+            Peak = atof( Buffer + 6 ) / (1<<10);
+    fclose( pFile );
+    // the running commands are the last ones in the profile
+    Vec_PtrForEachEntryReverse( Cmd_Prof_t *, pAbc->vProfile, p, i )
+    {
+        if ( p->fDone )
+            continue;
+        p->MemPeak = Abc_MaxDouble( p->MemPeak, Peak );
+        if ( p->Level == 0 )
+            break;
+    }
+    if ( (pFile = fopen( "/proc/self/clear_refs", "w" )) == NULL )
+        return;
+    fputs( "5", pFile );
+    fclose( pFile );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the number of levels without changing the networks.]
+
+  Description [The level computation overwrites the levels stored in the
+  objects, which the commands may rely on, so they are saved and restored.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_ProfNtkLevel( Abc_Ntk_t * pNtk )
+{
+    Vec_Int_t * vLevels = Vec_IntStart( Abc_NtkObjNumMax(pNtk) );
+    Abc_Obj_t * pObj;
+    int i, nLevels;
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        Vec_IntWriteEntry( vLevels, i, pObj->Level );
+    nLevels = Abc_NtkLevel( pNtk );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        pObj->Level = Vec_IntEntry( vLevels, i );
+    Vec_IntFree( vLevels );
+    return nLevels;
+}
+static int Cmd_ProfGiaLevel( Gia_Man_t * p )
+{
+    Vec_Int_t * vLevels = p->vLevels ? Vec_IntDup( p->vLevels ) : NULL;
+    int nLevelsOld = p->nLevels, nLevels = Gia_ManLevelNum( p );
+    Vec_IntFreeP( &p->vLevels );
+    p->vLevels = vLevels;
+    p->nLevels = nLevelsOld;
+    return nLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the sizes of the networks in the framework.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ProfCollect( Abc_Frame_t * pAbc, Cmd_ProfNtk_t * pNtkInfo )
+{
+    Abc_Ntk_t * pNtk = pAbc->pNtkCur;
+    pNtkInfo->nNodes  = pNtkInfo->nLevels    = -1;
+    pNtkInfo->Area    = pNtkInfo->Delay      = -1;
+    pNtkInfo->nGiaAnds = pNtkInfo->nGiaLevels = -1;
+    if ( pNtk )
+    {
+        int fHasTimeMan = (int)(pNtk->pManTime != NULL);
+        pNtkInfo->nNodes = Abc_NtkNodeNum( pNtk );
+        if ( Abc_NtkIsStrash(pNtk) )
+            pNtkInfo->nLevels = Abc_AigLevel( pNtk );
+        else if ( Abc_NtkIsLogic(pNtk) )
+            pNtkInfo->nLevels = Cmd_ProfNtkLevel( pNtk );
+        if ( Abc_NtkIsMappedLogic(pNtk) )
+        {
+            pNtkInfo->Area  = Abc_NtkGetMappedArea( pNtk );
+            pNtkInfo->Delay = Abc_NtkDelayTrace( pNtk, NULL, NULL, 0 );
+            if ( !fHasTimeMan && pNtk->pManTime )
+            {
+                Abc_ManTimeStop( pNtk->pManTime );
+                pNtk->pManTime = NULL;
+            }
+        }
+    }
+    if ( pAbc->pGia )
+    {
+        pNtkInfo->nGiaAnds   = Gia_ManAndNum( pAbc->pGia );
+        pNtkInfo->nGiaLevels = Cmd_ProfGiaLevel( pAbc->pGia );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts profiling the command.]
+
+  Description [Returns NULL if profiling is off.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cmd_ProfStart( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Cmd_Prof_t * p;
+    Vec_Str_t * vCommand;
+    int i;
+    if ( !pAbc->fProfile || !strcmp(argv[0], "profile") )
+        return NULL;
+    if ( pAbc->vProfile == NULL )
+        pAbc->vProfile = Vec_PtrAlloc( 100 );
+    vCommand = Vec_StrAlloc( 100 );
+    for ( i = 0; i < argc; i++ )
+    {
+        if ( i ) Vec_StrPush( vCommand, ' ' );
+        Vec_StrPrintStr( vCommand, argv[i] );
+    }
+    Vec_StrPush( vCommand, '\0' );
+    p = ABC_CALLOC( Cmd_Prof_t, 1 );
+    p->pCommand = Vec_StrReleaseArray( vCommand );
+    Vec_StrFree( vCommand );
+    p->Id       = Vec_PtrSize( pAbc->vProfile );
+    p->Level    = pAbc->nProfLevel++;
+    Cmd_ProfCollect( pAbc, &p->Before );
+    Cmd_ProfUpdatePeak( pAbc );
+    Vec_PtrPush( pAbc->vProfile, p );
+    p->TimeCpu  = (double)clock() / CLOCKS_PER_SEC;
+    p->TimeWall = Extra_CpuTimeDouble();
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finishes profiling the command.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_ProfStop( Abc_Frame_t * pAbc, void * pProf )
+{
+    Cmd_Prof_t * p = (Cmd_Prof_t *)pProf;
+    if ( p == NULL )
+        return;
+    p->TimeWall = Extra_CpuTimeDouble() - p->TimeWall;
+    p->TimeCpu  = (double)clock() / CLOCKS_PER_SEC - p->TimeCpu;
+    Cmd_ProfUpdatePeak( pAbc );
+    p->fDone    = 1;
+    Cmd_ProfCollect( pAbc, &p->After );
+    pAbc->nProfLevel--;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sorting the records by decreasing elapsed time.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_ProfCompare( Cmd_Prof_t ** pp1, Cmd_Prof_t ** pp2 )
+{
+    if ( (*pp1)->TimeWall > (*pp2)->TimeWall )
+        return -1;
+    if ( (*pp1)->TimeWall < (*pp2)->TimeWall )
+        return 1;
+    return (*pp1)->Id - (*pp2)->Id;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the network size before and after the command.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ProfPrintValue( FILE * pFile, double Before, double After, int nDigits, int nWidth )
+{
+    char Buffer[100], * pCur = Buffer;
+    if ( Before != After )
+    {
+        pCur += Before == -1 ? sprintf( pCur, "none" ) : sprintf( pCur, "%.*f", nDigits, Before );
+        pCur += sprintf( pCur, "->" );
+    }
+    if ( After == -1 )
+        sprintf( pCur, Before != After ? "none" : "-" );
+    else
+        sprintf( pCur, "%.*f", nDigits, After );
+    fprintf( pFile, " %*s", nWidth, Buffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the records in JSON.]
+
+  Description [The profile is appended to the file as one record of the
+  JSON writer (see Json_WrtStart).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ProfWriteJsonNtk( Json_Wrt_t * pJson, char * pName, Cmd_ProfNtk_t * p )
+{
+    Json_WrtObjStart( pJson, pName );
+    Json_WrtInt(   pJson, "nodes",      p->nNodes );
+    Json_WrtInt(   pJson, "levels",     p->nLevels );
+    Json_WrtFloat( pJson, "area",       p->Area );
+    Json_WrtFloat( pJson, "delay",      p->Delay );
+    Json_WrtInt(   pJson, "gia_ands",   p->nGiaAnds );
+    Json_WrtInt(   pJson, "gia_levels", p->nGiaLevels );
+    Json_WrtObjStop( pJson );
+}
+static int Cmd_ProfWriteJson( Vec_Ptr_t * vProfile, double MemPeak, char * pFileName )
+{
+    Json_Wrt_t * pJson;
+    Cmd_Prof_t * p;
+    int i;
+    if ( (pJson = Json_WrtStart( pFileName, "profile" )) == NULL )
+        return 0;
+    Json_WrtArrStart( pJson, "commands" );
+    Vec_PtrForEachEntry( Cmd_Prof_t *, vProfile, p, i )
+    {
+        Json_WrtObjStart( pJson, NULL );
+        Json_WrtInt(   pJson, "id",          p->Id );
+        Json_WrtInt(   pJson, "level",       p->Level );
+        Json_WrtStr(   pJson, "command",     p->pCommand );
+        Json_WrtFloat( pJson, "wall",        p->TimeWall );
+        Json_WrtFloat( pJson, "cpu",         p->TimeCpu );
+        Json_WrtFloat( pJson, "peak_mem_mb", p->MemPeak );
+        Cmd_ProfWriteJsonNtk( pJson, "before", &p->Before );
+        Cmd_ProfWriteJsonNtk( pJson, "after",  &p->After );
+        Json_WrtObjStop( pJson );
+    }
+    Json_WrtArrStop( pJson );
+    Json_WrtFloat( pJson, "peak_mem_mb", MemPeak );
+    Json_WrtStop( pJson );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the profile sorted by runtime.]
+
+  Description [Only the top-level commands are counted in the total
+  runtime, because the runtime of the nested commands is included into
+  the runtime of the commands that called them.  If the file name is
+  given, also writes the profile in JSON.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_ProfReport( Abc_Frame_t * pAbc, char * pFileName )
+{
+    Vec_Ptr_t * vSorted;
+    Cmd_Prof_t * p;
+    double TimeWall = 0, TimeCpu = 0, MemPeak = 0;
+    int i;
+    if ( pAbc->vProfile == NULL || Vec_PtrSize(pAbc->vProfile) == 0 )
+    {
+        fprintf( pAbc->Out, "The profile is empty.\n" );
+        return;
+    }
+    Vec_PtrForEachEntry( Cmd_Prof_t *, pAbc->vProfile, p, i )
+        if ( p->Level == 0 )
+            TimeWall += p->TimeWall, TimeCpu += p->TimeCpu, MemPeak = Abc_MaxDouble( MemPeak, p->MemPeak );
+    vSorted = Vec_PtrDup( pAbc->vProfile );
+    Vec_PtrSort( vSorted, (int (*)(const void *, const void *))Cmd_ProfCompare );
+    fprintf( pAbc->Out, "%5s %9s %6s %9s %9s %15s %15s %21s %21s %15s  %s\n",
+        "Id", "Wall", "%", "Cpu", "Peak(MB)", "Nodes", "Levels", "Area", "Delay", "&-Ands", "Command" );
+    Vec_PtrForEachEntry( Cmd_Prof_t *, vSorted, p, i )
+    {
+        fprintf( pAbc->Out, "%5d %9.3f %6.2f %9.3f %9.2f", p->Id, p->TimeWall,
+            TimeWall > 0 ? 100.0 * p->TimeWall / TimeWall : 0.0, p->TimeCpu, p->MemPeak );
+        Cmd_ProfPrintValue( pAbc->Out, p->Before.nNodes,   p->After.nNodes,   0, 15 );
+        Cmd_ProfPrintValue( pAbc->Out, p->Before.nLevels,  p->After.nLevels,  0, 15 );
+        Cmd_ProfPrintValue( pAbc->Out, p->Before.Area,     p->After.Area,     2, 21 );
+        Cmd_ProfPrintValue( pAbc->Out, p->Before.Delay,    p->After.Delay,    2, 21 );
+        Cmd_ProfPrintValue( pAbc->Out, p->Before.nGiaAnds, p->After.nGiaAnds, 0, 15 );
+        fprintf( pAbc->Out, "  %*s%s\n", 2 * p->Level, "", p->pCommand );
+    }
+    fprintf( pAbc->Out, "Total: %d commands.  Wall = %.3f sec.  Cpu = %.3f sec.  Peak memory = %.2f MB.\n",
+        Vec_PtrSize(pAbc->vProfile), TimeWall, TimeCpu, MemPeak );
+    Vec_PtrFree( vSorted );
+    pAbc->nProfReported = Vec_PtrSize(pAbc->vProfile);
+    if ( pFileName == NULL )
+        return;
+    if ( Cmd_ProfWriteJson( pAbc->vProfile, MemPeak, pFileName ) )
+        fprintf( pAbc->Out, "The profile was appended to file \"%s\".\n", pFileName );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the profile.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_ProfClean( Abc_Frame_t * pAbc )
+{
+    Cmd_Prof_t * p;
+    int i;
+    if ( pAbc->vProfile == NULL )
+        return;
+    Vec_PtrForEachEntry( Cmd_Prof_t *, pAbc->vProfile, p, i )
+    {
+        ABC_FREE( p->pCommand );
+        ABC_FREE( p );
+    }
+    Vec_PtrFree( pAbc->vProfile );
+    pAbc->vProfile = NULL;
+    pAbc->nProfReported = 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -104,6 +104,7 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     int (*pFunc) ( Abc_Frame_t *, int, char ** );
     Abc_Command * pCommand;
     char * value;
+    void * pProf;
     int fError;
     double clk;
 
@@ -152,10 +153,12 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     }
 
     // execute the command
+    pProf = Cmd_ProfStart( pAbc, argc, argv );
     clk = Extra_CpuTimeDouble();
     pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
     fError = (*pFunc)( pAbc, argc, argv );
     pAbc->TimeCommand += Extra_CpuTimeDouble() - clk;
+    Cmd_ProfStop( pAbc, pProf );
 
     // automatic execution of arbitrary command after each command 
     // usually this is a passive command ... 
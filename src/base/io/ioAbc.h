@@ -64,6 +64,7 @@ typedef enum {
     IO_FILE_PLA,      
     IO_FILE_MOPLA,      
     IO_FILE_SMV,      
+    IO_FILE_SNAP,      
     IO_FILE_VERILOG,    
     IO_FILE_UNKNOWN       
 } Io_FileType_t;
@@ -73,6 +74,8 @@ typedef enum {
 ////////////////////////////////////////////////////////////////////////
 
 #define  IO_WRITE_LINE_LENGTH    78    // the output line length
+#define  IO_SNAP_MAGIC    "ABC-SNAP" // the first entry of the binary snapshot header
+#define  IO_SNAP_VERSION         1    // the version of the binary snapshot format
 
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
@@ -97,6 +100,8 @@ extern Abc_Ntk_t *        Io_ReadEdif( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadEqn( char * pFileName, int fCheck );
 /*=== abcReadPla.c ============================================================*/
 extern Abc_Ntk_t *        Io_ReadPla( char * pFileName, int fZeros, int fBoth, int fOnDc, int fSkipPrepro, int fCheck );
+/*=== abcReadSnap.c ===========================================================*/
+extern Abc_Ntk_t *        Io_ReadSnap( char * pFileName, int fCheck );
 /*=== abcReadVerilog.c ========================================================*/
 extern Abc_Ntk_t *        Io_ReadVerilog( char * pFileName, int fCheck );
 /*=== abcWriteAiger.c =========================================================*/
@@ -139,6 +144,8 @@ extern int                Io_WritePla( Abc_Ntk_t * pNtk, char * FileName );
 extern int                Io_WriteMoPla( Abc_Ntk_t * pNtk, char * FileName );
 /*=== abcWriteSmv.c ===========================================================*/
 extern int                Io_WriteSmv( Abc_Ntk_t * pNtk, char * FileName );
+/*=== abcWriteSnap.c ==========================================================*/
+extern int                Io_WriteSnap( Abc_Ntk_t * pNtk, char * pFileName );
 /*=== abcWriteVerilog.c =======================================================*/
 extern void               Io_WriteVerilog( Abc_Ntk_t * pNtk, char * FileName, int fOnlyAnds, int fNewInterface );
 /*=== abcUtil.c ===============================================================*/
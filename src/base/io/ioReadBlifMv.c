@@ -22,6 +22,7 @@
 #include "misc/bzlib/bzlib.h"
 #include "base/abc/abc.h"
 #include "misc/vec/vecPtr.h"
+#include "base/main/main.h"
 #include "ioAbc.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -31,11 +32,25 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 #define IO_BLIFMV_MAXVALUES 256
+#define IO_BLIFMV_PAR_LINES 10000  // the min number of .names lines parsed by several threads
 //#define IO_VERBOSE_OUTPUT
 
+// the name table is shared by several threads only if atomics are available
+#if defined(ABC_USE_PTHREADS) && (defined(__GNUC__) || defined(__clang__))
+#define IO_BLIFMV_PAR_ATOMIC 1
+static inline char * Io_MvNameLoad( char ** p )                        { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                          }
+static inline int    Io_MvNameCas( char ** p, char * Old, char * New ) { return __atomic_compare_exchange_n( p, &Old, New, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ); }
+#else
+#define IO_BLIFMV_PAR_ATOMIC 0
+static inline char * Io_MvNameLoad( char ** p )                        { return *p;                                 }
+static inline int    Io_MvNameCas( char ** p, char * Old, char * New ) { if ( *p != Old ) return 0; *p = New; return 1; }
+#endif
+
 typedef struct Io_MvVar_t_ Io_MvVar_t; // parsing var
 typedef struct Io_MvMod_t_ Io_MvMod_t; // parsing model
 typedef struct Io_MvMan_t_ Io_MvMan_t; // parsing manager
+typedef struct Io_MvTab_t_ Io_MvTab_t; // concurrent name table
+typedef struct Io_MvJob_t_ Io_MvJob_t; // chunk of .names lines
 
 Vec_Ptr_t *vGlobalLtlArray;
 
@@ -74,6 +89,7 @@ struct Io_MvMan_t_
     // general info about file
     int                  fBlifMv;      // the file is BLIF-MV
     int                  fUseReset;    // the reset circuitry is added
+    int                  nThreads;     // the number of threads parsing .names lines
     char *               pFileName;    // the name of the file
     char *               pBuffer;      // the contents of the file
     Vec_Ptr_t *          vLines;       // the line beginnings
@@ -94,6 +110,30 @@ struct Io_MvMan_t_
     int                  nTablesLeft;  // the number of dangling tables
 };
 
+struct Io_MvTab_t_
+{
+    char **              pNames;       // the first occurrence of each name (NULL for empty slots)
+    Abc_Obj_t **         pNets;        // the net of each name (or NULL if not created yet)
+    int                  nMask;        // the table size minus one
+    int                  fGates;       // the .gate lines created nets missing in the table
+};
+
+struct Io_MvJob_t_
+{
+    Io_MvMod_t *         pMod;         // the model
+    Io_MvTab_t *         pTab;         // the name table (NULL in the first pass)
+    int                  iStart;       // the first .names line of the chunk
+    int                  iStop;        // the line following the last one
+    Vec_Ptr_t *          vTokens;      // the tokens of all lines
+    Vec_Int_t *          vLines;       // the first token and the cover of each line
+    Vec_Int_t *          vIds;         // the name table slot of each token (or -1)
+    Vec_Str_t *          vSops;        // the covers of all lines
+    Vec_Ptr_t *          vTemp;        // the tokens of the current line
+    Vec_Str_t *          vFunc;        // the cover of the current line
+    int                  iError;       // the line whose table is incorrect (or -1)
+    char                 sError[512];  // the error message of this line
+};
+
 // static functions
 static Io_MvMan_t *      Io_MvAlloc();
 static void              Io_MvFree( Io_MvMan_t * p );
@@ -114,6 +154,7 @@ static Vec_Int_t *       Io_MvParseLineOnehot( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineMv( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineNamesMv( Io_MvMod_t * p, char * pLine, int fReset );
 static int               Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine );
+static int               Io_MvParseLinesNamesBlifPar( Io_MvMod_t * p );
 static int               Io_MvParseLineShortBlif( Io_MvMod_t * p, char * pLine );
 static int                 Io_MvParseLineLtlProperty( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineGateBlif( Io_MvMod_t * p, Vec_Ptr_t * vTokens );
@@ -162,6 +203,7 @@ Abc_Ntk_t * Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck )
     p = Io_MvAlloc();
     p->fBlifMv   = fBlifMv;
     p->fUseReset = 1;
+    p->nThreads  = Abc_FrameReadFlag("blifthreads") ? Abc_MaxInt( 1, atoi(Abc_FrameReadFlag("blifthreads")) ) : 1;
     p->pFileName = pFileName;
     p->pBuffer   = Io_MvLoadFile( pFileName );
     if ( p->pBuffer == NULL )
@@ -985,6 +1027,14 @@ static Abc_Des_t * Io_MvParse( Io_MvMan_t * p )
                 if ( !Io_MvParseLineNamesMv( pMod, pLine, 0 ) )
                     return NULL;
         }
+        else if ( p->nThreads > 1 && Vec_PtrSize(pMod->vNames) >= IO_BLIFMV_PAR_LINES )
+        {
+            if ( !Io_MvParseLinesNamesBlifPar( pMod ) )
+                return NULL;
+            Vec_PtrForEachEntry( char *, pMod->vShorts, pLine, k )
+                if ( !Io_MvParseLineShortBlif( pMod, pLine ) )
+                    return NULL;
+        }
         else
         {
             Vec_PtrForEachEntry( char *, pMod->vNames, pLine, k )
@@ -2021,65 +2071,70 @@ static int Io_MvParseLineNamesMv( Io_MvMod_t * p, char * pLine, int fReset )
 
   Synopsis    [Constructs the SOP cover from the file parsing info.]
 
-  Description []
+  Description [Writes the cover into vFunc. Returns 0 and writes the 
+  message into pError if the table is incorrect. Does not touch the 
+  model, so that several threads can parse different tables.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
+static int Io_MvParseTableBlifInt( Io_MvMan_t * pMan, char * pTable, int nFanins, Vec_Ptr_t * vTokens, Vec_Str_t * vFunc, char * pError )
 {
-    Vec_Ptr_t * vTokens = p->pMan->vTokens;
-    Vec_Str_t * vFunc = p->pMan->vFunc;
     char * pProduct, * pOutput, c;
     int i, Polarity = -1;
 
-    p->pMan->nTablesRead++;
     // get the tokens
     Io_MvSplitIntoTokens( vTokens, pTable, '.' );
+    Vec_StrClear( vFunc );
     if ( Vec_PtrSize(vTokens) == 0 )
-        return Abc_SopCreateConst0( (Mem_Flex_t *)p->pNtk->pManFunc );
+    {
+        Vec_StrPrintStr( vFunc, " 0\n" );
+        Vec_StrPush( vFunc, '\0' );
+        return 1;
+    }
     if ( Vec_PtrSize(vTokens) == 1 )
     {
         pOutput = (char *)Vec_PtrEntry( vTokens, 0 );
         c = pOutput[0];
         if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
         {
-            sprintf( p->pMan->sError, "Line %d: Constant table has wrong output value \"%s\".", Io_MvGetLine(p->pMan, pOutput), pOutput );
-            return NULL;
+            sprintf( pError, "Line %d: Constant table has wrong output value \"%s\".", Io_MvGetLine(pMan, pOutput), pOutput );
+            return 0;
         }
-        return pOutput[0] == '0' ? Abc_SopCreateConst0((Mem_Flex_t *)p->pNtk->pManFunc) : Abc_SopCreateConst1((Mem_Flex_t *)p->pNtk->pManFunc);
+        Vec_StrPrintStr( vFunc, pOutput[0] == '0' ? " 0\n" : " 1\n" );
+        Vec_StrPush( vFunc, '\0' );
+        return 1;
     }
     pProduct = (char *)Vec_PtrEntry( vTokens, 0 );
     if ( Vec_PtrSize(vTokens) % 2 == 1 )
     {
-        sprintf( p->pMan->sError, "Line %d: Table has odd number of tokens (%d).", Io_MvGetLine(p->pMan, pProduct), Vec_PtrSize(vTokens) );
-        return NULL;
+        sprintf( pError, "Line %d: Table has odd number of tokens (%d).", Io_MvGetLine(pMan, pProduct), Vec_PtrSize(vTokens) );
+        return 0;
     }
     // parse the table
-    Vec_StrClear( vFunc );
     for ( i = 0; i < Vec_PtrSize(vTokens)/2; i++ )
     {
         pProduct = (char *)Vec_PtrEntry( vTokens, 2*i + 0 );
         pOutput  = (char *)Vec_PtrEntry( vTokens, 2*i + 1 );
         if ( strlen(pProduct) != (unsigned)nFanins )
         {
-            sprintf( p->pMan->sError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", Io_MvGetLine(p->pMan, pProduct), pProduct, nFanins );
-            return NULL;
+            sprintf( pError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", Io_MvGetLine(pMan, pProduct), pProduct, nFanins );
+            return 0;
         }
         c = pOutput[0];
         if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
         {
-            sprintf( p->pMan->sError, "Line %d: Output value \"%s\" is incorrect.", Io_MvGetLine(p->pMan, pProduct), pOutput );
-            return NULL;
+            sprintf( pError, "Line %d: Output value \"%s\" is incorrect.", Io_MvGetLine(pMan, pProduct), pOutput );
+            return 0;
         }
         if ( Polarity == -1 )
             Polarity = (c=='1' || c=='x');
         else if ( Polarity != (c=='1' || c=='x') )
         {
-            sprintf( p->pMan->sError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", Io_MvGetLine(p->pMan, pProduct), pOutput, Polarity );
-            return NULL;
+            sprintf( pError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", Io_MvGetLine(pMan, pProduct), pOutput, Polarity );
+            return 0;
         }
         // parse one product 
         Vec_StrPrintStr( vFunc, pProduct );
@@ -2088,7 +2143,14 @@ static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
         Vec_StrPush( vFunc, '\n' );
     }
     Vec_StrPush( vFunc, '\0' );
-    return Vec_StrArray( vFunc );
+    return 1;
+}
+static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
+{
+    p->pMan->nTablesRead++;
+    if ( !Io_MvParseTableBlifInt( p->pMan, pTable, nFanins, p->pMan->vTokens, p->pMan->vFunc, p->pMan->sError ) )
+        return NULL;
+    return Vec_StrArray( p->pMan->vFunc );
 }
 
 /**Function*************************************************************
@@ -2131,6 +2193,263 @@ static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the name to the concurrent name table.]
+
+  Description [Returns the slot of the name. The table is never resized;
+  it is allocated with the room for all tokens.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Io_MvNameHash( char * pName )
+{
+    unsigned Key = 0;
+    for ( ; *pName; pName++ )
+        Key = Key * 31 + (unsigned char)*pName;
+    return Key * 0x9E3779B1;
+}
+static int Io_MvNameInsert( Io_MvTab_t * p, char * pName )
+{
+    int iSlot = (int)(Io_MvNameHash(pName) & (unsigned)p->nMask);
+    char * pOld;
+    while ( 1 )
+    {
+        pOld = Io_MvNameLoad( p->pNames + iSlot );
+        if ( pOld == NULL )
+        {
+            if ( Io_MvNameCas( p->pNames + iSlot, NULL, pName ) )
+                return iSlot;
+            pOld = Io_MvNameLoad( p->pNames + iSlot );
+        }
+        if ( !strcmp(pOld, pName) )
+            return iSlot;
+        iSlot = (iSlot + 1) & p->nMask;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses one chunk of the .names lines.]
+
+  Description [In the first pass (pTab == NULL), splits the lines into 
+  tokens and constructs the covers; stops at the first incorrect table.
+  In the second pass, adds the signal names to the name table. Only the 
+  part of the file buffer belonging to the lines of the chunk is changed.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_MvParseNamesJob( void * pArg )
+{
+    Io_MvJob_t * p = (Io_MvJob_t *)pArg;
+    char * pLine, * pName;
+    int i, k, iFirst, iStop;
+    if ( p->pTab == NULL )
+    {
+        for ( i = p->iStart; i < p->iStop; i++ )
+        {
+            pLine = (char *)Vec_PtrEntry( p->pMod->vNames, i );
+            Io_MvSplitIntoTokens( p->vTemp, pLine, '\0' );
+            Vec_IntPush( p->vLines, Vec_PtrSize(p->vTokens) );
+            Vec_PtrAppend( p->vTokens, p->vTemp );
+            if ( !strcmp((char *)Vec_PtrEntry(p->vTemp,0), "gate") )
+            {
+                Vec_IntPush( p->vLines, -1 );
+                continue;
+            }
+            pName = (char *)Vec_PtrEntryLast( p->vTemp );
+            if ( !Io_MvParseTableBlifInt( p->pMod->pMan, pName + strlen(pName), Abc_MaxInt(0, Vec_PtrSize(p->vTemp) - 2), p->vTemp, p->vFunc, p->sError ) )
+            {
+                Vec_IntPush( p->vLines, -1 );
+                p->iError = i;
+                break;
+            }
+            Vec_IntPush( p->vLines, Vec_StrSize(p->vSops) );
+            Vec_StrPushBuffer( p->vSops, Vec_StrArray(p->vFunc), Vec_StrSize(p->vFunc) );
+        }
+        Vec_IntPush( p->vLines, Vec_PtrSize(p->vTokens) );
+        return 1;
+    }
+    Vec_IntFill( p->vIds, Vec_PtrSize(p->vTokens), -1 );
+    for ( i = 0; i < Vec_IntSize(p->vLines) / 2; i++ )
+    {
+        if ( Vec_IntEntry(p->vLines, 2*i+1) == -1 && p->iStart + i != p->iError )
+            continue;
+        // skip the keyword unless it is the only token
+        iFirst = Vec_IntEntry( p->vLines, 2*i );
+        iStop  = Vec_IntEntry( p->vLines, 2*i+2 );
+        for ( k = Abc_MinInt(iFirst + 1, iStop - 1); k < iStop; k++ )
+            Vec_IntWriteEntry( p->vIds, k, Io_MvNameInsert(p->pTab, (char *)Vec_PtrEntry(p->vTokens, k)) );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the net with the given name.]
+
+  Description [Creates the net in the same way as Abc_NtkFindOrCreateNet().]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Abc_Obj_t * Io_MvNameNet( Io_MvMod_t * p, Io_MvTab_t * pTab, Io_MvJob_t * pJob, int iToken )
+{
+    int iSlot = Vec_IntEntry( pJob->vIds, iToken );
+    Abc_Obj_t * pNet = pTab->pNets[iSlot];
+    if ( pNet == NULL && pTab->fGates )
+        pNet = pTab->pNets[iSlot] = Abc_NtkFindOrCreateNet( p->pNtk, (char *)Vec_PtrEntry(pJob->vTokens, iToken) );
+    else if ( pNet == NULL )
+    {
+        // the nets existing before parsing are in the table, so the net is new
+        pNet = pTab->pNets[iSlot] = Abc_NtkCreateNet( p->pNtk );
+        Nm_ManStoreIdName( p->pNtk->pManName, pNet->Id, pNet->Type, (char *)Vec_PtrEntry(pJob->vTokens, iToken), NULL );
+    }
+    return pNet;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the .names lines using several threads.]
+
+  Description [The lines are divided into chunks of consecutive lines. 
+  The threads tokenize the lines, construct the covers and resolve the 
+  signal names into the slots of the concurrent name table. After that,
+  the nodes and the nets are created in the order of the lines, so that 
+  the resulting network is the same as the one derived by parsing the 
+  lines one at a time with Io_MvParseLineNamesBlif().]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_MvParseLinesNamesBlifPar( Io_MvMod_t * p )
+{
+    Io_MvTab_t Tab, * pTab = &Tab;
+    Io_MvJob_t * pJobs, * pJob;
+    Vec_Ptr_t * vJobs, * vTokens = p->pMan->vTokens;
+    Abc_Obj_t * pNet, * pNode;
+    char * pName;
+    int nThreads = Abc_MinInt( p->pMan->nThreads, 64 );
+    int nLines = Vec_PtrSize(p->vNames);
+    int i, k, j, iFirst, iStop, iSop, nTokens, RetValue = 1;
+    assert( !p->pMan->fBlifMv );
+    pJobs = ABC_CALLOC( Io_MvJob_t, nThreads );
+    vJobs = Vec_PtrAlloc( nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pJob = pJobs + i;
+        pJob->pMod    = p;
+        pJob->iStart  = (int)((word)nLines * i / nThreads);
+        pJob->iStop   = (int)((word)nLines * (i+1) / nThreads);
+        pJob->vTokens = Vec_PtrAlloc( 4 * (pJob->iStop - pJob->iStart) + 16 );
+        pJob->vLines  = Vec_IntAlloc( 2 * (pJob->iStop - pJob->iStart) + 1 );
+        pJob->vIds    = Vec_IntAlloc( 0 );
+        pJob->vSops   = Vec_StrAlloc( 8 * (pJob->iStop - pJob->iStart) + 16 );
+        pJob->vTemp   = Vec_PtrAlloc( 16 );
+        pJob->vFunc   = Vec_StrAlloc( 64 );
+        pJob->iError  = -1;
+        Vec_PtrPush( vJobs, pJob );
+    }
+    // tokenize the lines and construct the covers
+    Util_ProcessThreads( Io_MvParseNamesJob, vJobs, IO_BLIFMV_PAR_ATOMIC ? nThreads + 1 : 1, 0, 0 );
+    // resolve the names
+    nTokens = Abc_NtkNetNum(p->pNtk);
+    for ( i = 0; i < nThreads; i++ )
+        nTokens += Vec_PtrSize(pJobs[i].vTokens);
+    pTab->nMask  = (1 << Abc_Base2Log(nTokens + nTokens / 2 + 2)) - 1;
+    pTab->fGates = 0;
+    pTab->pNames = ABC_CALLOC( char *, pTab->nMask + 1 );
+    pTab->pNets  = ABC_CALLOC( Abc_Obj_t *, pTab->nMask + 1 );
+    // add the nets created by the interface and the latches
+    Abc_NtkForEachNet( p->pNtk, pNet, i )
+    {
+        if ( (pName = Nm_ManFindNameById(p->pNtk->pManName, pNet->Id)) == NULL )
+            continue;
+        k = Io_MvNameInsert( pTab, pName );
+        if ( pTab->pNets[k] == NULL )
+            pTab->pNets[k] = Abc_NtkFindNet( p->pNtk, pName );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        pJobs[i].pTab = pTab;
+    Util_ProcessThreads( Io_MvParseNamesJob, vJobs, IO_BLIFMV_PAR_ATOMIC ? nThreads + 1 : 1, 0, 0 );
+    // make room for the names of the new nets
+    for ( k = i = 0; i <= pTab->nMask; i++ )
+        k += (pTab->pNames[i] != NULL && pTab->pNets[i] == NULL);
+    Nm_ManReserve( p->pNtk->pManName, k );
+    // create the nodes in the order of the lines
+    for ( i = 0; i < nThreads && RetValue; i++ )
+    {
+        pJob = pJobs + i;
+        for ( k = 0; k < Vec_IntSize(pJob->vLines) / 2; k++ )
+        {
+            iFirst = Vec_IntEntry( pJob->vLines, 2*k );
+            iStop  = Vec_IntEntry( pJob->vLines, 2*k+2 );
+            iSop   = Vec_IntEntry( pJob->vLines, 2*k+1 );
+            if ( iSop == -1 && pJob->iStart + k != pJob->iError )
+            {
+                // parse the mapped node
+                Vec_PtrClear( vTokens );
+                for ( j = iFirst; j < iStop; j++ )
+                    Vec_PtrPush( vTokens, Vec_PtrEntry(pJob->vTokens, j) );
+                pTab->fGates = 1;
+                if ( !Io_MvParseLineGateBlif( p, vTokens ) )
+                {
+                    RetValue = 0;
+                    break;
+                }
+                continue;
+            }
+            pName = (char *)Vec_PtrEntry( pJob->vTokens, iStop - 1 );
+            pNet = Io_MvNameNet( p, pTab, pJob, iStop - 1 );
+            if ( Abc_ObjFaninNum(pNet) > 0 )
+            {
+                sprintf( p->pMan->sError, "Line %d: Signal \"%s\" is defined more than once.", Io_MvGetLine(p->pMan, pName), pName );
+                RetValue = 0;
+                break;
+            }
+            p->pMan->nTablesRead++;
+            if ( iSop == -1 )
+            {
+                strcpy( p->pMan->sError, pJob->sError );
+                RetValue = 0;
+                break;
+            }
+            // create the node with its fanins and the fanout net
+            pNode = Abc_NtkCreateNode( p->pNtk );
+            for ( j = iFirst + 1; j < iStop - 1; j++ )
+                Abc_ObjAddFanin( pNode, Io_MvNameNet(p, pTab, pJob, j) );
+            Abc_ObjAddFanin( pNet, pNode );
+            pNode->pData = Abc_SopRegister( (Mem_Flex_t *)p->pNtk->pManFunc, Vec_StrEntryP(pJob->vSops, iSop) );
+        }
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pJob = pJobs + i;
+        Vec_PtrFree( pJob->vTokens );
+        Vec_IntFree( pJob->vLines );
+        Vec_IntFree( pJob->vIds );
+        Vec_StrFree( pJob->vSops );
+        Vec_PtrFree( pJob->vTemp );
+        Vec_StrFree( pJob->vFunc );
+    }
+    ABC_FREE( pJobs );
+    Vec_PtrFree( vJobs );
+    ABC_FREE( pTab->pNames );
+    ABC_FREE( pTab->pNets );
+    return RetValue;
+}
+
 ABC_NAMESPACE_IMPL_END
 
 #include "map/mio/mio.h"
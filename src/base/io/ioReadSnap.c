@@ -0,0 +1,398 @@
+/**CFile****************************************************************
+
+  FileName    [ioReadSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Procedures to read the mapped network in the binary format.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "base/main/main.h"
+#include "map/mio/mio.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the timing info stored as two floats.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Abc_Time_t Io_ReadSnapTime( int * pBuffer )
+{
+    Abc_Time_t Time;
+    memcpy( &Time.Rise, pBuffer + 0, sizeof(float) );
+    memcpy( &Time.Fall, pBuffer + 1, sizeof(float) );
+    return Time;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one 0-terminated entry of the header.]
+
+  Description [Returns NULL if the entry is not terminated before the end
+  of the file.  The number is accepted only if it is a non-negative
+  decimal that does not exceed the limit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_ReadSnapStr( char ** ppCur, char * pEnd )
+{
+    char * pStr = *ppCur, * pZero;
+    if ( pStr >= pEnd )
+        return NULL;
+    pZero = (char *)memchr( pStr, 0, pEnd - pStr );
+    if ( pZero == NULL )
+        return NULL;
+    *ppCur = pZero + 1;
+    return pStr;
+}
+static int Io_ReadSnapNum( char ** ppCur, char * pEnd, int Limit, int * pNum )
+{
+    char * pStr = Io_ReadSnapStr( ppCur, pEnd ), * pStop;
+    long Num;
+    if ( pStr == NULL || *pStr < '0' || *pStr > '9' )
+        return 0;
+    Num = strtol( pStr, &pStop, 10 );
+    if ( *pStop || Num > Limit )
+        return 0;
+    *pNum = (int)Num;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the mapped network in the binary format.]
+
+  Description [The gates are bound to the current library by name once
+  for each entry of the gate table stored in the file.  Every entry is
+  read within the bounds of the file, and the counts in the header are
+  checked against the file size before anything is allocated.]
+
+  SideEffects []
+
+  SeeAlso     [Io_WriteSnap]
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadSnap( char * pFileName, int fCheck )
+{
+    Mio_Library_t * pLib = (Mio_Library_t *)Abc_FrameReadLibGen();
+    Mio_Gate_t ** ppGates = NULL;
+    Abc_Ntk_t * pNtkNew = NULL;
+    Abc_Obj_t * pObj, * pNode0, * pNode1, ** ppObjs = NULL;
+    FILE * pFile;
+    Abc_Time_t Time;
+    char * pContents, * pEnd, * pName, * pLibName, * pCur, * pGateName, * pOutName, * pMagic;
+    int * pBody, * pGateIds, * pFanins, * pDrivers, * pInits, * pTimes;
+    int nInputs, nOutputs, nLatches, nNodes, nGates, nEdges, fTiming, nCis, nCos, nObjs;
+    int nFileSize, Version, nPins, i, k, e;
+    ABC_INT64_T nNamesMin, nBodySize;
+
+    if ( pLib == NULL )
+    {
+        printf( "Io_ReadSnap: The current library is not available.\n" );
+        return NULL;
+    }
+    // read the file into the buffer
+    nFileSize = Extra_FileSize( pFileName );
+    if ( nFileSize < 0 )
+    {
+        printf( "Io_ReadSnap: Cannot read file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_ALLOC( char, nFileSize + 1 );
+    if ( (int)fread( pContents, 1, nFileSize, pFile ) != nFileSize )
+    {
+        fclose( pFile );
+        ABC_FREE( pContents );
+        printf( "Io_ReadSnap: Cannot read file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    fclose( pFile );
+    pContents[nFileSize] = 0;
+    pEnd = pContents + nFileSize;
+
+    // skip the comments (comment lines begin with '#' and end with '\n')
+    for ( pCur = pContents; pCur < pEnd && *pCur == '#'; )
+        while ( pCur < pEnd && *pCur++ != '\n' );
+
+    // read the header
+    pMagic = Io_ReadSnapStr( &pCur, pEnd );
+    if ( pMagic == NULL || strcmp( pMagic, IO_SNAP_MAGIC ) )
+    {
+        printf( "Io_ReadSnap: File \"%s\" is not a binary snapshot.\n", pFileName );
+        goto finish;
+    }
+    if ( !Io_ReadSnapNum( &pCur, pEnd, ABC_INFINITY, &Version ) || Version != IO_SNAP_VERSION )
+    {
+        printf( "Io_ReadSnap: The snapshot version is not supported (expected %d).\n", IO_SNAP_VERSION );
+        goto finish;
+    }
+    pName    = Io_ReadSnapStr( &pCur, pEnd );
+    pLibName = Io_ReadSnapStr( &pCur, pEnd );
+    if ( pName == NULL || pLibName == NULL ||
+         !Io_ReadSnapNum( &pCur, pEnd, nFileSize, &nInputs )  ||
+         !Io_ReadSnapNum( &pCur, pEnd, nFileSize, &nOutputs ) ||
+         !Io_ReadSnapNum( &pCur, pEnd, nFileSize, &nLatches ) ||
+         !Io_ReadSnapNum( &pCur, pEnd, nFileSize, &nNodes )   ||
+         !Io_ReadSnapNum( &pCur, pEnd, nFileSize, &nGates )   ||
+         !Io_ReadSnapNum( &pCur, pEnd, nFileSize, &nEdges )   ||
+         !Io_ReadSnapNum( &pCur, pEnd, 7, &fTiming ) )
+    {
+        printf( "Io_ReadSnap: The header is truncated or corrupted.\n" );
+        goto finish;
+    }
+    nCis  = nInputs + nLatches;
+    nCos  = nOutputs + nLatches;
+    nObjs = nCis + nNodes;
+    // each name takes at least one byte and each body entry takes four bytes
+    nNamesMin = (ABC_INT64_T)nInputs + nOutputs + 3 * (ABC_INT64_T)nLatches + nNodes + 2 * (ABC_INT64_T)nGates;
+    nBodySize = (ABC_INT64_T)nNodes + nEdges + nCos + nLatches;
+    if ( fTiming & 1 )
+        nBodySize += 8 + 2 * (ABC_INT64_T)nCis + 2 * (ABC_INT64_T)nCos;
+    if ( fTiming & 2 )
+        nBodySize += 2 * (ABC_INT64_T)nCis;
+    if ( fTiming & 4 )
+        nBodySize += 2 * (ABC_INT64_T)nCos;
+    if ( nNamesMin + 4 * nBodySize > pEnd - pCur )
+    {
+        printf( "Io_ReadSnap: The file size does not match the header.\n" );
+        goto finish;
+    }
+    if ( strcmp( pLibName, Mio_LibraryReadName(pLib) ) )
+        printf( "Io_ReadSnap: Warning: The network was mapped with library \"%s\" but the current library is \"%s\".\n", pLibName, Mio_LibraryReadName(pLib) );
+
+    // bind the gate table to the current library
+    ppGates = ABC_ALLOC( Mio_Gate_t *, nGates + 1 );
+    for ( i = 0; i < nGates; i++ )
+    {
+        pGateName = Io_ReadSnapStr( &pCur, pEnd );
+        pOutName  = Io_ReadSnapStr( &pCur, pEnd );
+        if ( pGateName == NULL || pOutName == NULL )
+            goto truncated;
+        ppGates[i] = Mio_LibraryReadGateByName( pLib, pGateName, pOutName );
+        if ( ppGates[i] == NULL )
+        {
+            printf( "Io_ReadSnap: Cannot find gate \"%s\" with output \"%s\" in the current library.\n", pGateName, pOutName );
+            goto finish;
+        }
+    }
+
+    // allocate the empty network
+    pNtkNew = Abc_NtkAlloc( ABC_NTK_LOGIC, ABC_FUNC_MAP, 1 );
+    pNtkNew->pName = Extra_UtilStrsav( pName );
+    pNtkNew->pSpec = Extra_UtilStrsav( pFileName );
+    ppObjs = ABC_ALLOC( Abc_Obj_t *, nObjs + 1 );
+
+    // create the PIs
+    for ( i = 0; i < nInputs; i++ )
+    {
+        if ( (pName = Io_ReadSnapStr( &pCur, pEnd )) == NULL )
+            goto truncated;
+        pObj = Abc_NtkCreatePi(pNtkNew);
+        Abc_ObjAssignName( pObj, pName, NULL );
+        ppObjs[i] = pObj;
+    }
+    // create the POs
+    for ( i = 0; i < nOutputs; i++ )
+    {
+        if ( (pName = Io_ReadSnapStr( &pCur, pEnd )) == NULL )
+            goto truncated;
+        pObj = Abc_NtkCreatePo(pNtkNew);
+        Abc_ObjAssignName( pObj, pName, NULL );
+    }
+    // create the latches
+    for ( i = 0; i < nLatches; i++ )
+    {
+        if ( (pName = Io_ReadSnapStr( &pCur, pEnd )) == NULL )
+            goto truncated;
+        pObj = Abc_NtkCreateLatch(pNtkNew);
+        Abc_ObjAssignName( pObj, pName, NULL );
+
+        if ( (pName = Io_ReadSnapStr( &pCur, pEnd )) == NULL )
+            goto truncated;
+        pNode0 = Abc_NtkCreateBi(pNtkNew);
+        Abc_ObjAssignName( pNode0, pName, NULL );
+
+        if ( (pName = Io_ReadSnapStr( &pCur, pEnd )) == NULL )
+            goto truncated;
+        pNode1 = Abc_NtkCreateBo(pNtkNew);
+        Abc_ObjAssignName( pNode1, pName, NULL );
+        ppObjs[nInputs + i] = pNode1;
+
+        Abc_ObjAddFanin( pObj, pNode0 );
+        Abc_ObjAddFanin( pNode1, pObj );
+    }
+    // create the internal nodes
+    for ( i = 0; i < nNodes; i++ )
+    {
+        if ( (pName = Io_ReadSnapStr( &pCur, pEnd )) == NULL )
+            goto truncated;
+        pObj = Abc_NtkCreateNode(pNtkNew);
+        if ( *pName )
+            Abc_ObjAssignName( pObj, pName, NULL );
+        ppObjs[nCis + i] = pObj;
+    }
+
+    // get the pointer to the beginning of the body
+    pCur += (4 - (pCur - pContents) % 4) % 4;
+    if ( pCur > pEnd || 4 * nBodySize != pEnd - pCur )
+    {
+        printf( "Io_ReadSnap: The file size does not match the header.\n" );
+        goto finish;
+    }
+    pBody    = (int *)pCur;
+    pGateIds = pBody;
+    pFanins  = pGateIds + nNodes;
+    pDrivers = pFanins + nEdges;
+    pInits   = pDrivers + nCos;
+    pTimes   = pInits + nLatches;
+
+    // set the gates and connect the internal nodes
+    for ( i = e = 0; i < nNodes; i++ )
+    {
+        pObj = ppObjs[nCis + i];
+        if ( pGateIds[i] < -1 || pGateIds[i] >= nGates )
+        {
+            printf( "Io_ReadSnap: Node %d has an invalid gate index %d.\n", i, pGateIds[i] );
+            goto finish;
+        }
+        pObj->pData = pGateIds[i] == -1 ? NULL : ppGates[pGateIds[i]];
+        nPins = pObj->pData ? Mio_GateReadPinNum((Mio_Gate_t *)pObj->pData) : 1;
+        if ( e + nPins > nEdges )
+            break;
+        for ( k = 0; k < nPins; k++, e++ )
+        {
+            if ( pFanins[e] < 0 || pFanins[e] >= nObjs )
+            {
+                printf( "Io_ReadSnap: Node %d has an invalid fanin %d.\n", i, pFanins[e] );
+                goto finish;
+            }
+            Abc_ObjAddFanin( pObj, ppObjs[pFanins[e]] );
+        }
+    }
+    if ( i < nNodes || e != nEdges )
+    {
+        printf( "Io_ReadSnap: The number of fanins does not match the gates.\n" );
+        goto finish;
+    }
+    // connect the COs and set the latch initial values
+    for ( i = 0; i < nCos; i++ )
+    {
+        if ( pDrivers[i] < 0 || pDrivers[i] >= nObjs )
+        {
+            printf( "Io_ReadSnap: Output %d has an invalid driver %d.\n", i, pDrivers[i] );
+            goto finish;
+        }
+        pObj = i < nOutputs ? Abc_NtkPo(pNtkNew, i) : Abc_ObjFanin0(Abc_NtkBox(pNtkNew, i - nOutputs));
+        Abc_ObjAddFanin( pObj, ppObjs[pDrivers[i]] );
+    }
+    for ( i = 0; i < nLatches; i++ )
+    {
+        if ( pInits[i] < ABC_INIT_NONE || pInits[i] > ABC_INIT_DC )
+        {
+            printf( "Io_ReadSnap: Latch %d has an invalid initial value %d.\n", i, pInits[i] );
+            goto finish;
+        }
+        Abc_ObjSetData( Abc_NtkBox(pNtkNew, i), (void *)(ABC_PTRINT_T)pInits[i] );
+    }
+
+    // set the timing info
+    if ( fTiming & 1 )
+    {
+        Time = Io_ReadSnapTime( pTimes );  pTimes += 2;
+        Abc_NtkTimeSetDefaultArrival( pNtkNew, Time.Rise, Time.Fall );
+        Time = Io_ReadSnapTime( pTimes );  pTimes += 2;
+        Abc_NtkTimeSetDefaultRequired( pNtkNew, Time.Rise, Time.Fall );
+        Time = Io_ReadSnapTime( pTimes );  pTimes += 2;
+        Abc_NtkTimeSetDefaultInputDrive( pNtkNew, Time.Rise, Time.Fall );
+        Time = Io_ReadSnapTime( pTimes );  pTimes += 2;
+        Abc_NtkTimeSetDefaultOutputLoad( pNtkNew, Time.Rise, Time.Fall );
+        for ( i = 0; i < nCis; i++, pTimes += 2 )
+        {
+            Time = Io_ReadSnapTime( pTimes );
+            Abc_NtkTimeSetArrival( pNtkNew, Abc_ObjId(ppObjs[i]), Time.Rise, Time.Fall );
+        }
+        for ( i = 0; i < nCos; i++, pTimes += 2 )
+        {
+            Time = Io_ReadSnapTime( pTimes );
+            pObj = i < nOutputs ? Abc_NtkPo(pNtkNew, i) : Abc_ObjFanin0(Abc_NtkBox(pNtkNew, i - nOutputs));
+            Abc_NtkTimeSetRequired( pNtkNew, Abc_ObjId(pObj), Time.Rise, Time.Fall );
+        }
+    }
+    if ( fTiming & 2 )
+    {
+        for ( i = 0; i < nCis; i++, pTimes += 2 )
+        {
+            Time = Io_ReadSnapTime( pTimes );
+            Abc_NtkTimeSetInputDrive( pNtkNew, i, Time.Rise, Time.Fall );
+        }
+    }
+    if ( fTiming & 4 )
+    {
+        for ( i = 0; i < nCos; i++, pTimes += 2 )
+        {
+            Time = Io_ReadSnapTime( pTimes );
+            Abc_NtkTimeSetOutputLoad( pNtkNew, i, Time.Rise, Time.Fall );
+        }
+    }
+    ABC_FREE( ppObjs );
+    ABC_FREE( ppGates );
+    ABC_FREE( pContents );
+
+    // check the result
+    if ( fCheck && !Abc_NtkCheckRead( pNtkNew ) )
+    {
+        printf( "Io_ReadSnap: The network check has failed.\n" );
+        Abc_NtkDelete( pNtkNew );
+        return NULL;
+    }
+    return pNtkNew;
+
+truncated:
+    printf( "Io_ReadSnap: The file is truncated.\n" );
+finish:
+    ABC_FREE( ppObjs );
+    ABC_FREE( ppGates );
+    ABC_FREE( pContents );
+    if ( pNtkNew )
+        Abc_NtkDelete( pNtkNew );
+    return NULL;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
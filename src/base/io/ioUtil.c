@@ -80,6 +80,8 @@ Io_FileType_t Io_ReadFileType( char * pFileName )
         return IO_FILE_PLA;
     if ( !strcmp( pExt, "smv" ) )
         return IO_FILE_SMV;
+    if ( !strcmp( pExt, "snap" ) )
+        return IO_FILE_SNAP;
     if ( !strcmp( pExt, "v" ) )
         return IO_FILE_VERILOG;
     return IO_FILE_UNKNOWN;
@@ -116,6 +118,17 @@ Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck
        return NULL;
     }
     fclose( pFile );
+    // read the mapped network
+    if ( FileType == IO_FILE_SNAP )
+    {
+        pNtk = Io_ReadSnap( pFileName, fCheck );
+        if ( pNtk == NULL )
+        {
+            fprintf( stdout, "Reading mapped network from file has failed.\n" );
+            return NULL;
+        }
+        return pNtk;
+    }
     // read the AIG
     if ( FileType == IO_FILE_AIGER || FileType == IO_FILE_BAF || FileType == IO_FILE_BBLIF )
     {
@@ -362,6 +375,16 @@ void Io_Write( Abc_Ntk_t * pNtk, char * pFileName, Io_FileType_t FileType )
         Io_WriteGml( pNtk, pFileName );
         return;
     }
+    if ( FileType == IO_FILE_SNAP )
+    {
+        if ( !Abc_NtkIsMappedLogic(pNtk) )
+        {
+            fprintf( stdout, "Writing the binary snapshot is only possible for mapped networks.\n" );
+            return;
+        }
+        Io_WriteSnap( pNtk, pFileName );
+        return;
+    }
     if ( FileType == IO_FILE_BBLIF )
     {
         if ( !Abc_NtkIsLogic(pNtk) )
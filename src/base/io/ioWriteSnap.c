@@ -0,0 +1,293 @@
+/**CFile****************************************************************
+
+  FileName    [ioWriteSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Procedures to write the mapped network in the binary format.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "map/mio/mio.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    Binary Snapshot Format (mapped networks)
+
+    The motivation for this format is to checkpoint a mapped network
+    without going through BLIF/Verilog, which requires re-parsing the text
+    and binding every gate to the library by name.  The gates are bound
+    once per distinct library gate, and the netlist is loaded using bulk
+    reads of integer arrays, similar to the BAF format (see ioWriteBaf.c).
+
+    The header:
+    (1) May contain several lines of human-readable comments.
+        Each comment line begins with symbol '#' and ends with symbol '\n'.
+    (2) Always contains the following data, each entry followed by 0-byte:
+        - the magic word "ABC-SNAP" (IO_SNAP_MAGIC)
+        - the format version (IO_SNAP_VERSION)
+        - network name
+        - library name
+        - number of PIs
+        - number of POs
+        - number of latches
+        - number of internal nodes
+        - number of entries in the gate table
+        - number of fanin edges of the internal nodes
+        - timing flags (1 = timing manager, 2 = input drives, 4 = output loads)
+    (3) Next follow the gate table (gate name and output pin name for each
+        entry), the names of PIs, POs, latches (latch, latch input, latch output),
+        and the names of internal nodes (an empty string if the node has no name).
+        Each name is followed by 0-byte (character '\0').
+    (4) The header is padded with 0-bytes to the multiple of 4 bytes.
+
+    The body (4-byte integers or floats):
+    (1) The gate table index of each internal node (-1 for a barrier buffer).
+    (2) The fanins of the internal nodes, in the order of the nodes and their pins.
+        The objects are numbered as follows: PIs, latch outputs, internal nodes.
+    (3) The drivers of the POs followed by the drivers of the latch inputs.
+    (4) The latch initial values.
+    (5) If the timing flags are present: default arrival, required, input drive,
+        and output load (rise/fall for each), followed by the arrival times of
+        the PIs and latch outputs and the required times of the POs and latch
+        inputs; then the input drives and the output loads if the flags say so.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writes a 0-terminated string.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Io_WriteSnapStr( FILE * pFile, char * pStr )
+{
+    fwrite( pStr, 1, strlen(pStr) + 1, pFile );
+}
+static inline void Io_WriteSnapNum( FILE * pFile, int Num )
+{
+    fprintf( pFile, "%d%c", Num, 0 );
+}
+static inline void Io_WriteSnapTime( Vec_Int_t * vBody, Abc_Time_t * pTime )
+{
+    union { float f; int i; } Rise, Fall;
+    Rise.f = pTime->Rise;
+    Fall.f = pTime->Fall;
+    Vec_IntPush( vBody, Rise.i );
+    Vec_IntPush( vBody, Fall.i );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the mapped network in the binary format.]
+
+  Description [Returns 1 on success, or 0 if the file could not be
+  written completely, in which case the partial file is removed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_WriteSnap( Abc_Ntk_t * pNtk, char * pFileName )
+{
+    Mio_Library_t * pLib = (Mio_Library_t *)pNtk->pManFunc;
+    FILE * pFile;
+    Vec_Ptr_t * vGates, * vCis, * vCos;
+    Vec_Int_t * vBody, * vCiOrder, * vCoOrder, * vGateIds;
+    Abc_Time_t * pTimes;
+    Mio_Gate_t * pGate;
+    Abc_Obj_t * pObj, * pFanin;
+    char * pName;
+    int i, k, nObjs, nEdges, fTiming, nPad, RetValue;
+    assert( Abc_NtkIsMappedLogic(pNtk) );
+    // start the output stream
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        fprintf( stdout, "Io_WriteSnap(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+
+    // number the objects: PIs, latch outputs, internal nodes
+    vCis = Vec_PtrAlloc( Abc_NtkCiNum(pNtk) );
+    vCos = Vec_PtrAlloc( Abc_NtkCoNum(pNtk) );
+    Abc_NtkForEachPi( pNtk, pObj, i )
+        Vec_PtrPush( vCis, pObj );
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        Vec_PtrPush( vCos, pObj );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+    {
+        Vec_PtrPush( vCis, Abc_ObjFanout0(pObj) );
+        Vec_PtrPush( vCos, Abc_ObjFanin0(pObj) );
+    }
+    Abc_NtkCleanCopy( pNtk );
+    nObjs = 0;
+    Vec_PtrForEachEntry( Abc_Obj_t *, vCis, pObj, i )
+        pObj->pCopy = (Abc_Obj_t *)(ABC_PTRINT_T)nObjs++;
+    Abc_NtkForEachNode( pNtk, pObj, i )
+        pObj->pCopy = (Abc_Obj_t *)(ABC_PTRINT_T)nObjs++;
+    // remember the file position of each CI/CO of the network
+    vCiOrder = Vec_IntAlloc( Abc_NtkCiNum(pNtk) );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        Vec_IntPush( vCiOrder, (int)(ABC_PTRINT_T)pObj->pCopy );
+    vCoOrder = Vec_IntStartFull( Abc_NtkCoNum(pNtk) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vCos, pObj, i )
+        pObj->pCopy = (Abc_Obj_t *)(ABC_PTRINT_T)i;
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        Vec_IntWriteEntry( vCoOrder, i, (int)(ABC_PTRINT_T)pObj->pCopy );
+
+    // collect the gates used in the network; their table index is mapped by the cell ID
+    vGates = Vec_PtrAlloc( 100 );
+    vGateIds = Vec_IntStartFull( Mio_LibraryReadGateNum(pLib) );
+    nEdges = 0;
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        nEdges += Abc_ObjFaninNum(pObj);
+        pGate = (Mio_Gate_t *)pObj->pData;
+        if ( pGate == NULL || Vec_IntEntry(vGateIds, Mio_GateReadCell(pGate)) >= 0 )
+            continue;
+        Vec_IntWriteEntry( vGateIds, Mio_GateReadCell(pGate), Vec_PtrSize(vGates) );
+        Vec_PtrPush( vGates, pGate );
+    }
+
+    // write the comment
+    fprintf( pFile, "# SNAP (Binary Snapshot of Mapped Network) for \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    // write the header
+    fTiming = 0;
+    if ( pNtk->pManTime )
+    {
+        fTiming |= 1;
+        if ( Abc_NtkCiNum(pNtk) && Abc_NodeReadInputDrive(pNtk, 0) )
+            fTiming |= 2;
+        if ( Abc_NtkCoNum(pNtk) && Abc_NodeReadOutputLoad(pNtk, 0) )
+            fTiming |= 4;
+    }
+    Io_WriteSnapStr( pFile, (char *)IO_SNAP_MAGIC );
+    Io_WriteSnapNum( pFile, IO_SNAP_VERSION );
+    Io_WriteSnapStr( pFile, pNtk->pName );
+    Io_WriteSnapStr( pFile, Mio_LibraryReadName(pLib) );
+    Io_WriteSnapNum( pFile, Abc_NtkPiNum(pNtk) );
+    Io_WriteSnapNum( pFile, Abc_NtkPoNum(pNtk) );
+    Io_WriteSnapNum( pFile, Abc_NtkLatchNum(pNtk) );
+    Io_WriteSnapNum( pFile, Abc_NtkNodeNum(pNtk) );
+    Io_WriteSnapNum( pFile, Vec_PtrSize(vGates) );
+    Io_WriteSnapNum( pFile, nEdges );
+    Io_WriteSnapNum( pFile, fTiming );
+    // write the gate table
+    Vec_PtrForEachEntry( Mio_Gate_t *, vGates, pGate, i )
+    {
+        Io_WriteSnapStr( pFile, Mio_GateReadName(pGate) );
+        Io_WriteSnapStr( pFile, Mio_GateReadOutName(pGate) );
+    }
+    // write the names
+    Abc_NtkForEachPi( pNtk, pObj, i )
+        Io_WriteSnapStr( pFile, Abc_ObjName(pObj) );
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        Io_WriteSnapStr( pFile, Abc_ObjName(pObj) );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+    {
+        Io_WriteSnapStr( pFile, Abc_ObjName(pObj) );
+        Io_WriteSnapStr( pFile, Abc_ObjName(Abc_ObjFanin0(pObj)) );
+        Io_WriteSnapStr( pFile, Abc_ObjName(Abc_ObjFanout0(pObj)) );
+    }
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        pName = Nm_ManFindNameById( pNtk->pManName, Abc_ObjId(pObj) );
+        Io_WriteSnapStr( pFile, pName ? pName : (char *)"" );
+    }
+    // align the body
+    for ( nPad = (4 - ftell(pFile) % 4) % 4; nPad > 0; nPad-- )
+        fputc( 0, pFile );
+
+    // collect the body
+    vBody = Vec_IntAlloc( 2 * Abc_NtkNodeNum(pNtk) + nEdges + Abc_NtkCoNum(pNtk) + Abc_NtkLatchNum(pNtk) );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+        Vec_IntPush( vBody, pObj->pData ? Vec_IntEntry(vGateIds, Mio_GateReadCell((Mio_Gate_t *)pObj->pData)) : -1 );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Vec_IntPush( vBody, (int)(ABC_PTRINT_T)pFanin->pCopy );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vCos, pObj, i )
+        Vec_IntPush( vBody, (int)(ABC_PTRINT_T)Abc_ObjFanin0(pObj)->pCopy );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+        Vec_IntPush( vBody, (int)(ABC_PTRINT_T)Abc_ObjData(pObj) );
+    if ( fTiming & 1 )
+    {
+        Io_WriteSnapTime( vBody, Abc_NtkReadDefaultArrival(pNtk) );
+        Io_WriteSnapTime( vBody, Abc_NtkReadDefaultRequired(pNtk) );
+        Io_WriteSnapTime( vBody, Abc_NtkReadDefaultInputDrive(pNtk) );
+        Io_WriteSnapTime( vBody, Abc_NtkReadDefaultOutputLoad(pNtk) );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vCis, pObj, i )
+            Io_WriteSnapTime( vBody, Abc_NodeReadArrival(pObj) );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vCos, pObj, i )
+            Io_WriteSnapTime( vBody, Abc_NodeReadRequired(pObj) );
+    }
+    if ( fTiming & 2 )
+    {
+        // the drives are stored in the order of the CIs in the file
+        pTimes = ABC_ALLOC( Abc_Time_t, Abc_NtkCiNum(pNtk) );
+        for ( i = 0; i < Abc_NtkCiNum(pNtk); i++ )
+            pTimes[Vec_IntEntry(vCiOrder, i)] = *Abc_NodeReadInputDrive(pNtk, i);
+        for ( i = 0; i < Abc_NtkCiNum(pNtk); i++ )
+            Io_WriteSnapTime( vBody, pTimes + i );
+        ABC_FREE( pTimes );
+    }
+    if ( fTiming & 4 )
+    {
+        // the loads are stored in the order of the COs in the file
+        pTimes = ABC_ALLOC( Abc_Time_t, Abc_NtkCoNum(pNtk) );
+        for ( i = 0; i < Abc_NtkCoNum(pNtk); i++ )
+            pTimes[Vec_IntEntry(vCoOrder, i)] = *Abc_NodeReadOutputLoad(pNtk, i);
+        for ( i = 0; i < Abc_NtkCoNum(pNtk); i++ )
+            Io_WriteSnapTime( vBody, pTimes + i );
+        ABC_FREE( pTimes );
+    }
+
+    // write the body
+    RetValue = (int)fwrite( Vec_IntArray(vBody), sizeof(int), Vec_IntSize(vBody), pFile ) == Vec_IntSize(vBody);
+    RetValue &= !ferror( pFile );
+    RetValue &= !fclose( pFile );
+    if ( !RetValue )
+    {
+        fprintf( stdout, "Io_WriteSnap(): Cannot write the output file \"%s\".\n", pFileName );
+        remove( pFileName );
+    }
+    Vec_IntFree( vBody );
+    Vec_IntFree( vGateIds );
+    Vec_IntFree( vCiOrder );
+    Vec_IntFree( vCoOrder );
+    Vec_PtrFree( vGates );
+    Vec_PtrFree( vCis );
+    Vec_PtrFree( vCos );
+    return RetValue;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
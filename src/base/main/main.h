@@ -168,6 +168,10 @@ extern ABC_DLL void            Abc_FrameSetMaxLoad( float Load );
 extern ABC_DLL void            Abc_FrameSetArrayMapping( int * p );
 extern ABC_DLL void            Abc_FrameSetBoxes( int * p );
 
+// mainSession.c
+extern ABC_DLL int             Abc_FrameSaveSession( Abc_Frame_t * p, char * pFileName );
+extern ABC_DLL int             Abc_FrameLoadSession( Abc_Frame_t * p, char * pFileName );
+
 ABC_NAMESPACE_HEADER_END
 
 #endif
@@ -91,6 +91,12 @@ struct Abc_Frame_t_
     // used for runtime measurement
     double          TimeCommand;   // the runtime of the last command
     double          TimeTotal;     // the total runtime of all commands
+    // used for profiling the commands
+    int             fProfile;      // profiling is on
+    int             nProfLevel;    // the nesting level of the profiled commands
+    int             nProfReported; // the number of commands in the last report
+    char *          pProfFile;     // the file for the profile in JSON
+    Vec_Ptr_t *     vProfile;      // the profile of the commands
     // temporary storage for structural choices
     Vec_Ptr_t *     vStore;        // networks to be used by choice
     // decomposition package    
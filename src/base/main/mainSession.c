@@ -0,0 +1,984 @@
+/**CFile****************************************************************
+
+  FileName    [mainSession.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [The main package.]
+
+  Synopsis    [Saving and restoring the state of the framework.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include <sys/stat.h>
+
+#ifndef S_ISREG
+#define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
+#endif
+
+#include "base/abc/abc.h"
+#include "mainInt.h"
+#include "base/io/ioAbc.h"
+#include "map/if/if.h"
+#include "map/mio/mio.h"
+#include "map/amap/amap.h"
+#include "map/scl/sclLib.h"
+#include "misc/util/utilSignal.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The session file consists of a human-readable comment line followed
+    by a sequence of sections.  Each section is written as a 0-terminated
+    tag, the 4-byte size of the section data, and the data itself.
+    The file starts with section "session" holding the format version
+    and ends with section "end".
+
+    The other sections (written in this order, if present):
+    - "flags"   : pairs of 0-terminated flag names and values
+    - "liblut"  : the LUT library (name, LUT size, pin-delay flag, areas, delays)
+    - "libscl"  : the Liberty library in the SCL binary format
+    - "genlib"  : the genlib library as text (name followed by the library)
+    - "ntk"     : the current network
+    - "ntkbest" : the network saved by command "save"
+    - "store"   : the networks stored for computing choices (one section each)
+    - "gia", "gia2", "giabest", "giabest2", "giasaved" : the AIGs in the &-space
+    - "cex"     : the current counter-example
+    - "stats"   : the verification status and the best-network statistics
+
+    A network is stored as the file extension defining its format
+    (baf for AIGs, snap for mapped networks, blif for logic networks),
+    the network name and spec, followed by the contents of the file.
+    An AIG in the &-space is stored as its name and spec, followed by
+    the AIGER file with the extensions (mapping, packing, etc).
+
+    Every embedded file (network, AIG, SCL library, genlib library) is
+    preceded by its 4-byte size and 4-byte checksum, which are checked
+    before the file is given to its parser, because the parsers expect
+    well-formed data.
+
+    The file is first written under a temporary name, which replaces
+    the target only if all sections are written.
+*/
+
+#define ABC_SESSION_VERSION  2
+
+typedef struct Abc_Sec_t_ Abc_Sec_t;
+struct Abc_Sec_t_
+{
+    char *          pTag;          // the section tag
+    char *          pData;         // the section data
+    int             nSize;         // the size of the data
+    void *          pObj;          // the object read from the data (or NULL)
+    void *          pObj2;         // the second object (the genlib for Amap)
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one section.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SessionWriteSection( FILE * pFile, char * pTag, Vec_Str_t * vData )
+{
+    int nSize = Vec_StrSize(vData);
+    return fwrite( pTag, 1, strlen(pTag) + 1, pFile ) == strlen(pTag) + 1 &&
+           fwrite( &nSize, sizeof(int), 1, pFile ) == 1 &&
+           (int)fwrite( Vec_StrArray(vData), 1, nSize, pFile ) == nSize;
+}
+static void Abc_SessionPushStr( Vec_Str_t * vData, char * pStr )
+{
+    Vec_StrPrintStr( vData, pStr ? pStr : (char *)"" );
+    Vec_StrPush( vData, '\0' );
+}
+static void Abc_SessionPushInt( Vec_Str_t * vData, int Num )
+{
+    Vec_StrPushBuffer( vData, (char *)&Num, sizeof(int) );
+}
+static void Abc_SessionPushFloat( Vec_Str_t * vData, float Num )
+{
+    Vec_StrPushBuffer( vData, (char *)&Num, sizeof(float) );
+}
+static unsigned Abc_SessionChecksum( char * pData, int nSize )
+{
+    unsigned Sum = 2166136261u;
+    int i;
+    for ( i = 0; i < nSize; i++ )
+        Sum = (Sum ^ (unsigned char)pData[i]) * 16777619u;
+    return Sum;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a temporary file name with the given extension.]
+
+  Description [The file is created; the name should be freed by the user.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_SessionTmpName( char * pExt )
+{
+    char * pFileName = NULL;
+    int fd = Util_SignalTmpFile( "__abcses_", pExt, &pFileName );
+    if ( fd == -1 )
+    {
+        printf( "Cannot create a temporary file.\n" );
+        return NULL;
+    }
+    close( fd );
+    return pFileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Appends the contents of the temporary file and removes it.]
+
+  Description [The contents are preceded by their size and checksum.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SessionTmpAppend( Vec_Str_t * vData, char * pFileName )
+{
+    FILE * pFile;
+    int nFileSize, RetValue = 0;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile != NULL )
+    {
+        nFileSize = Extra_FileSize( pFileName );
+        Vec_StrGrow( vData, Vec_StrSize(vData) + 2 * sizeof(int) + nFileSize );
+        if ( nFileSize > 0 && (int)fread( Vec_StrArray(vData) + Vec_StrSize(vData) + 2 * sizeof(int), 1, nFileSize, pFile ) == nFileSize )
+        {
+            char * pContents = Vec_StrArray(vData) + Vec_StrSize(vData) + 2 * sizeof(int);
+            Abc_SessionPushInt( vData, nFileSize );
+            Abc_SessionPushInt( vData, (int)Abc_SessionChecksum(pContents, nFileSize) );
+            vData->nSize += nFileSize;
+            RetValue = 1;
+        }
+        fclose( pFile );
+    }
+    Util_SignalTmpFileRemove( pFileName, 0 );
+    free( pFileName );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the data into a temporary file.]
+
+  Description [Returns the file name, which should be freed by the user.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_SessionTmpWrite( char * pExt, char * pData, int nSize )
+{
+    FILE * pFile;
+    char * pFileName = Abc_SessionTmpName( pExt );
+    if ( pFileName == NULL )
+        return NULL;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL || (int)fwrite( pData, 1, nSize, pFile ) != nSize )
+    {
+        if ( pFile ) fclose( pFile );
+        Util_SignalTmpFileRemove( pFileName, 0 );
+        free( pFileName );
+        return NULL;
+    }
+    fclose( pFile );
+    return pFileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the network.]
+
+  Description [Reuses the binary writers (BAF for AIGs, snapshot for
+  mapped networks) and BLIF for the remaining logic networks.  The
+  networks of other types are skipped.  Returns 0 if writing failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SessionWriteNtk( FILE * pFile, char * pTag, Abc_Ntk_t * pNtk )
+{
+    Vec_Str_t * vData;
+    char * pExt, * pFileName;
+    int RetValue;
+    if ( Abc_NtkIsStrash(pNtk) )
+        pExt = ".baf";
+    else if ( Abc_NtkIsMappedLogic(pNtk) )
+        pExt = ".snap";
+    else if ( Abc_NtkIsLogic(pNtk) )
+        pExt = ".blif";
+    else
+    {
+        printf( "Skipping network \"%s\" of unsupported type.\n", pNtk->pName );
+        return 1;
+    }
+    if ( (pFileName = Abc_SessionTmpName( pExt )) == NULL )
+        return 0;
+    Io_Write( pNtk, pFileName, Io_ReadFileType(pFileName) );
+    vData = Vec_StrAlloc( 1000 );
+    Abc_SessionPushStr( vData, pExt + 1 );
+    Abc_SessionPushStr( vData, pNtk->pName );
+    Abc_SessionPushStr( vData, pNtk->pSpec );
+    if ( !Abc_SessionTmpAppend( vData, pFileName ) )
+    {
+        printf( "Cannot save network \"%s\".\n", pNtk->pName );
+        Vec_StrFree( vData );
+        return 0;
+    }
+    RetValue = Abc_SessionWriteSection( pFile, pTag, vData );
+    Vec_StrFree( vData );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG from the &-space.]
+
+  Description [Returns 0 if writing failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SessionWriteGia( FILE * pFile, char * pTag, Gia_Man_t * p )
+{
+    Vec_Str_t * vData;
+    char * pFileName;
+    int RetValue;
+    if ( (pFileName = Abc_SessionTmpName( ".aig" )) == NULL )
+        return 0;
+    Gia_AigerWrite( p, pFileName, 1, 0, 0 );
+    vData = Vec_StrAlloc( 1000 );
+    Abc_SessionPushStr( vData, p->pName );
+    Abc_SessionPushStr( vData, p->pSpec );
+    if ( !Abc_SessionTmpAppend( vData, pFileName ) )
+    {
+        printf( "Cannot save AIG \"%s\".\n", p->pName );
+        Vec_StrFree( vData );
+        return 0;
+    }
+    RetValue = Abc_SessionWriteSection( pFile, pTag, vData );
+    Vec_StrFree( vData );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the libraries.]
+
+  Description [Returns 0 if writing failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SessionWriteLibs( FILE * pFile, Abc_Frame_t * p )
+{
+    Vec_Str_t * vData = Vec_StrAlloc( 1000 );
+    char * pFileName;
+    int i, k, RetValue = 1;
+    if ( p->pLibLut )
+    {
+        If_LibLut_t * pLib = (If_LibLut_t *)p->pLibLut;
+        Vec_StrClear( vData );
+        Abc_SessionPushStr( vData, pLib->pName );
+        Abc_SessionPushInt( vData, pLib->LutMax );
+        Abc_SessionPushInt( vData, pLib->fVarPinDelays );
+        for ( i = 0; i <= IF_MAX_LUTSIZE; i++ )
+            Abc_SessionPushFloat( vData, pLib->pLutAreas[i] );
+        for ( i = 0; i <= IF_MAX_LUTSIZE; i++ )
+            for ( k = 0; k <= IF_MAX_LUTSIZE; k++ )
+                Abc_SessionPushFloat( vData, pLib->pLutDelays[i][k] );
+        RetValue &= Abc_SessionWriteSection( pFile, "liblut", vData );
+    }
+    if ( p->pLibScl )
+    {
+        Vec_StrClear( vData );
+        pFileName = Abc_SessionTmpName( ".scl" );
+        if ( pFileName )
+            Abc_SclWriteScl( pFileName, (SC_Lib *)p->pLibScl );
+        if ( pFileName && Abc_SessionTmpAppend( vData, pFileName ) )
+            RetValue &= Abc_SessionWriteSection( pFile, "libscl", vData );
+        else
+        {
+            printf( "Cannot save the Liberty library.\n" );
+            RetValue = 0;
+        }
+    }
+    if ( p->pLibGen )
+    {
+        FILE * pTemp = NULL;
+        Vec_StrClear( vData );
+        Abc_SessionPushStr( vData, Mio_LibraryReadName((Mio_Library_t *)p->pLibGen) );
+        pFileName = Abc_SessionTmpName( ".genlib" );
+        if ( pFileName && (pTemp = fopen( pFileName, "wb" )) )
+        {
+            Mio_WriteLibrary( pTemp, (Mio_Library_t *)p->pLibGen, 0, 0, 0 );
+            fclose( pTemp );
+        }
+        if ( pFileName && Abc_SessionTmpAppend( vData, pFileName ) )
+        {
+            Vec_StrPush( vData, '\0' );
+            RetValue &= Abc_SessionWriteSection( pFile, "genlib", vData );
+        }
+        else
+        {
+            printf( "Cannot save the genlib library.\n" );
+            RetValue = 0;
+        }
+    }
+    Vec_StrFree( vData );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the state of the framework into a file.]
+
+  Description [Returns 1 if the file was written.  A regular file is
+  written under a temporary name and renamed over the target only if
+  all sections are written, so that the old session is not lost when
+  writing fails.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_FrameSaveSession( Abc_Frame_t * p, char * pFileName )
+{
+    Gia_Man_t * pGias[5] = { p->pGia, p->pGia2, p->pGiaBest, p->pGiaBest2, p->pGiaSaved };
+    char * pGiaTags[5]   = { "gia", "gia2", "giabest", "giabest2", "giasaved" };
+    Vec_Str_t * vData;
+    Abc_Ntk_t * pNtk;
+    FILE * pFile;
+    st__generator * gen;
+    struct stat Stat;
+    char * pKey, * pValue, * pTmpName = NULL;
+    int i, RetValue = 1;
+    // non-regular files (such as devices) cannot be replaced by renaming
+    if ( stat( pFileName, &Stat ) != 0 || S_ISREG(Stat.st_mode) )
+    {
+        pTmpName = ABC_ALLOC( char, strlen(pFileName) + 5 );
+        sprintf( pTmpName, "%s.tmp", pFileName );
+    }
+    pFile = fopen( pTmpName ? pTmpName : pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pTmpName ? pTmpName : pFileName );
+        ABC_FREE( pTmpName );
+        return 0;
+    }
+    RetValue &= fprintf( pFile, "# ABC session written by ABC on %s\n", Extra_TimeStamp() ) > 0;
+    vData = Vec_StrAlloc( 1000 );
+    Abc_SessionPushInt( vData, ABC_SESSION_VERSION );
+    RetValue &= Abc_SessionWriteSection( pFile, "session", vData );
+    // flags
+    Vec_StrClear( vData );
+    st__foreach_item( p->tFlags, gen, (const char **)&pKey, (char **)&pValue )
+    {
+        Abc_SessionPushStr( vData, pKey );
+        Abc_SessionPushStr( vData, pValue );
+    }
+    RetValue &= Abc_SessionWriteSection( pFile, "flags", vData );
+    // libraries
+    RetValue &= Abc_SessionWriteLibs( pFile, p );
+    // networks
+    if ( p->pNtkCur )
+        RetValue &= Abc_SessionWriteNtk( pFile, "ntk", p->pNtkCur );
+    if ( p->pNtkBest )
+        RetValue &= Abc_SessionWriteNtk( pFile, "ntkbest", p->pNtkBest );
+    Vec_PtrForEachEntry( Abc_Ntk_t *, p->vStore, pNtk, i )
+        RetValue &= Abc_SessionWriteNtk( pFile, "store", pNtk );
+    for ( i = 0; i < 5; i++ )
+        if ( pGias[i] )
+            RetValue &= Abc_SessionWriteGia( pFile, pGiaTags[i], pGias[i] );
+    // counter-example
+    if ( p->pCex )
+    {
+        Vec_StrClear( vData );
+        Abc_SessionPushInt( vData, p->pCex->iPo );
+        Abc_SessionPushInt( vData, p->pCex->iFrame );
+        Abc_SessionPushInt( vData, p->pCex->nRegs );
+        Abc_SessionPushInt( vData, p->pCex->nPis );
+        Abc_SessionPushInt( vData, p->pCex->nBits );
+        Vec_StrPushBuffer( vData, (char *)p->pCex->pData, sizeof(unsigned) * Abc_BitWordNum(p->pCex->nBits) );
+        RetValue &= Abc_SessionWriteSection( pFile, "cex", vData );
+    }
+    // statistics
+    Vec_StrClear( vData );
+    Abc_SessionPushInt( vData, p->Status );
+    Abc_SessionPushInt( vData, p->nFrames );
+    Abc_SessionPushFloat( vData, p->nBestNtkArea );
+    Abc_SessionPushFloat( vData, p->nBestNtkDelay );
+    Abc_SessionPushInt( vData, p->nBestNtkNodes );
+    Abc_SessionPushInt( vData, p->nBestNtkLevels );
+    Abc_SessionPushInt( vData, p->nBestLuts );
+    Abc_SessionPushInt( vData, p->nBestEdges );
+    Abc_SessionPushInt( vData, p->nBestLevels );
+    Abc_SessionPushInt( vData, p->nBestLuts2 );
+    Abc_SessionPushInt( vData, p->nBestEdges2 );
+    Abc_SessionPushInt( vData, p->nBestLevels2 );
+    RetValue &= Abc_SessionWriteSection( pFile, "stats", vData );
+    // the end
+    Vec_StrClear( vData );
+    RetValue &= Abc_SessionWriteSection( pFile, "end", vData );
+    Vec_StrFree( vData );
+    RetValue &= !ferror( pFile );
+    RetValue &= fclose( pFile ) == 0;
+    if ( RetValue && pTmpName )
+    {
+#ifdef WIN32
+        remove( pFileName );
+#endif
+        RetValue = rename( pTmpName, pFileName ) == 0;
+    }
+    if ( !RetValue )
+    {
+        printf( "Writing session file \"%s\" has failed.\n", pFileName );
+        if ( pTmpName )
+            remove( pTmpName );
+    }
+    ABC_FREE( pTmpName );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one 0-terminated string of the section.]
+
+  Description [Returns NULL if the string is not terminated inside the
+  section.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_SessionReadStr( char ** ppCur, char * pEnd )
+{
+    char * pStr = *ppCur, * pStop;
+    if ( pStr >= pEnd || (pStop = (char *)memchr( pStr, '\0', pEnd - pStr )) == NULL )
+        return NULL;
+    *ppCur = pStop + 1;
+    return pStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the embedded file, which ends the section.]
+
+  Description [Checks that the size of the file matches the rest of the
+  section and that the checksum is correct.  Returns NULL if the file is
+  damaged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_SessionReadFile( char * pCur, char * pEnd, int * pnSize )
+{
+    int nSize;
+    unsigned Checksum;
+    if ( pEnd - pCur < 2 * (int)sizeof(int) )
+        return NULL;
+    memcpy( &nSize, pCur, sizeof(int) );
+    memcpy( &Checksum, pCur + sizeof(int), sizeof(int) );
+    pCur += 2 * sizeof(int);
+    if ( nSize <= 0 || nSize != pEnd - pCur || Checksum != Abc_SessionChecksum(pCur, nSize) )
+        return NULL;
+    *pnSize = nSize;
+    return pCur;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the network.]
+
+  Description [The header (format, name, spec) is checked when the file
+  is loaded, while the network is read after the libraries are restored,
+  because a mapped network refers to the gates of the genlib library.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_SessionReadNtkHeader( Abc_Sec_t * pSec, char ** ppName, char ** ppSpec, char ** ppFile, int * pnSize )
+{
+    char * pExt, * pCur = pSec->pData, * pEnd = pSec->pData + pSec->nSize;
+    if ( (pExt    = Abc_SessionReadStr( &pCur, pEnd )) == NULL ||
+         (*ppName = Abc_SessionReadStr( &pCur, pEnd )) == NULL ||
+         (*ppSpec = Abc_SessionReadStr( &pCur, pEnd )) == NULL )
+        return NULL;
+    if ( strcmp(pExt, "baf") && strcmp(pExt, "snap") && strcmp(pExt, "blif") )
+        return NULL;
+    if ( (*ppFile = Abc_SessionReadFile( pCur, pEnd, pnSize )) == NULL )
+        return NULL;
+    return pExt;
+}
+static Abc_Ntk_t * Abc_SessionReadNtk( Abc_Sec_t * pSec )
+{
+    Abc_Ntk_t * pNtk;
+    char * pExt, * pName, * pSpec, * pFile;
+    char * pFileName, Ext[16];
+    int nSize;
+    if ( (pExt = Abc_SessionReadNtkHeader( pSec, &pName, &pSpec, &pFile, &nSize )) == NULL )
+        return NULL;
+    sprintf( Ext, ".%s", pExt );
+    pFileName = Abc_SessionTmpWrite( Ext, pFile, nSize );
+    if ( pFileName == NULL )
+        return NULL;
+    if ( !strcmp(pExt, "blif") )
+    {
+        // use the reader that keeps the timing information
+        Abc_Ntk_t * pNetlist = Io_ReadBlif( pFileName, 1 );
+        pNtk = pNetlist ? Abc_NtkToLogic( pNetlist ) : NULL;
+        if ( pNetlist )
+            Abc_NtkDelete( pNetlist );
+    }
+    else
+        pNtk = Io_Read( pFileName, Io_ReadFileType(pFileName), 1, 0 );
+    Util_SignalTmpFileRemove( pFileName, 0 );
+    free( pFileName );
+    if ( pNtk == NULL )
+        return NULL;
+    ABC_FREE( pNtk->pName );
+    ABC_FREE( pNtk->pSpec );
+    pNtk->pName = Extra_UtilStrsav( pName );
+    pNtk->pSpec = *pSpec ? Extra_UtilStrsav( pSpec ) : NULL;
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG from the &-space.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Abc_SessionReadGia( Abc_Sec_t * pSec )
+{
+    Gia_Man_t * p;
+    char * pName, * pSpec, * pFile, * pCur = pSec->pData, * pEnd = pSec->pData + pSec->nSize;
+    int nSize;
+    if ( (pName = Abc_SessionReadStr( &pCur, pEnd )) == NULL ||
+         (pSpec = Abc_SessionReadStr( &pCur, pEnd )) == NULL ||
+         (pFile = Abc_SessionReadFile( pCur, pEnd, &nSize )) == NULL )
+        return NULL;
+    p = Gia_AigerReadFromMemory( pFile, nSize, 0, 1, 0 );
+    if ( p == NULL )
+        return NULL;
+    ABC_FREE( p->pName );
+    ABC_FREE( p->pSpec );
+    p->pName = *pName ? Abc_UtilStrsav( pName ) : NULL;
+    p->pSpec = *pSpec ? Abc_UtilStrsav( pSpec ) : NULL;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the libraries.]
+
+  Description [The libraries are only derived here; they are installed
+  by Abc_SessionInstallLib().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SessionReadLib( Abc_Sec_t * pSec )
+{
+    char * pName, * pFile, * pCur = pSec->pData, * pEnd = pSec->pData + pSec->nSize;
+    int i, k, nSize;
+    if ( !strcmp(pSec->pTag, "liblut") )
+    {
+        If_LibLut_t * pLib;
+        if ( (pName = Abc_SessionReadStr( &pCur, pEnd )) == NULL )
+            return 0;
+        if ( pEnd - pCur != (int)sizeof(int) * (2 + (IF_MAX_LUTSIZE+1) * (IF_MAX_LUTSIZE+2)) )
+            return 0;
+        pLib = ABC_CALLOC( If_LibLut_t, 1 );
+        pLib->pName = Abc_UtilStrsav( pName );
+        memcpy( &pLib->LutMax, pCur, sizeof(int) );         pCur += sizeof(int);
+        memcpy( &pLib->fVarPinDelays, pCur, sizeof(int) );  pCur += sizeof(int);
+        for ( i = 0; i <= IF_MAX_LUTSIZE; i++, pCur += sizeof(float) )
+            memcpy( &pLib->pLutAreas[i], pCur, sizeof(float) );
+        for ( i = 0; i <= IF_MAX_LUTSIZE; i++ )
+            for ( k = 0; k <= IF_MAX_LUTSIZE; k++, pCur += sizeof(float) )
+                memcpy( &pLib->pLutDelays[i][k], pCur, sizeof(float) );
+        if ( pLib->LutMax < 0 || pLib->LutMax > IF_MAX_LUTSIZE )
+        {
+            If_LibLutFree( pLib );
+            return 0;
+        }
+        pSec->pObj = pLib;
+        return 1;
+    }
+    if ( !strcmp(pSec->pTag, "libscl") )
+    {
+        Vec_Str_t * vStr;
+        if ( (pFile = Abc_SessionReadFile( pCur, pEnd, &nSize )) == NULL )
+            return 0;
+        vStr = Vec_StrAllocArray( pFile, nSize );
+        pSec->pObj = Abc_SclReadFromStr( vStr );
+        vStr->pArray = NULL;
+        Vec_StrFree( vStr );
+        return pSec->pObj != NULL;
+    }
+    if ( !strcmp(pSec->pTag, "genlib") )
+    {
+        Vec_Str_t * vStr, * vStr2;
+        // the library is followed by the terminating 0
+        if ( (pName = Abc_SessionReadStr( &pCur, pEnd )) == NULL || pCur == pEnd || pEnd[-1] != '\0' )
+            return 0;
+        if ( (pFile = Abc_SessionReadFile( pCur, pEnd - 1, &nSize )) == NULL )
+            return 0;
+        vStr = Vec_StrAlloc( nSize + 1 );
+        Vec_StrPushBuffer( vStr, pFile, nSize );
+        vStr2 = Vec_StrDup( vStr );
+        Vec_StrAppend( vStr2, ".end\n" );
+        Vec_StrPush( vStr2, '\0' );
+        Vec_StrPush( vStr, '\0' );
+        pSec->pObj = Mio_LibraryRead( pName, Vec_StrArray(vStr), NULL, 0, 0 );
+        if ( pSec->pObj )
+            pSec->pObj2 = Amap_LibReadAndPrepare( pName, Vec_StrArray(vStr2), 0, 0 );
+        Vec_StrFree( vStr );
+        Vec_StrFree( vStr2 );
+        return pSec->pObj2 != NULL;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks and reads one section without changing the framework.]
+
+  Description [The networks are only checked (see Abc_SessionReadNtk()).
+  The other sections are converted into the objects, which are installed
+  by Abc_SessionInstall() or freed by Abc_SessionFreeSec().  Returns 0 if
+  the section is not valid.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SessionReadSec( Abc_Sec_t * pSec )
+{
+    char * pCur, * pEnd = pSec->pData + pSec->nSize, * pName, * pSpec, * pFile;
+    int nSize;
+    if ( !strcmp(pSec->pTag, "session") || !strcmp(pSec->pTag, "end") )
+        return 1;
+    if ( !strcmp(pSec->pTag, "flags") )
+    {
+        for ( pCur = pSec->pData; pCur < pEnd; )
+            if ( Abc_SessionReadStr( &pCur, pEnd ) == NULL || Abc_SessionReadStr( &pCur, pEnd ) == NULL )
+                return 0;
+        return 1;
+    }
+    if ( !strncmp(pSec->pTag, "lib", 3) || !strcmp(pSec->pTag, "genlib") )
+        return Abc_SessionReadLib( pSec );
+    if ( !strcmp(pSec->pTag, "ntk") || !strcmp(pSec->pTag, "ntkbest") || !strcmp(pSec->pTag, "store") )
+        return Abc_SessionReadNtkHeader( pSec, &pName, &pSpec, &pFile, &nSize ) != NULL;
+    if ( !strcmp(pSec->pTag, "gia") || !strcmp(pSec->pTag, "gia2") || !strcmp(pSec->pTag, "giabest") ||
+         !strcmp(pSec->pTag, "giabest2") || !strcmp(pSec->pTag, "giasaved") )
+        return (pSec->pObj = Abc_SessionReadGia( pSec )) != NULL;
+    if ( !strcmp(pSec->pTag, "cex") )
+    {
+        int Info[5];
+        Abc_Cex_t * pCex;
+        if ( pSec->nSize < 5 * (int)sizeof(int) )
+            return 0;
+        memcpy( Info, pSec->pData, 5 * sizeof(int) );
+        if ( Info[4] < 0 || (size_t)pSec->nSize != sizeof(int) * (5 + (size_t)Abc_BitWordNum(Info[4])) )
+            return 0;
+        pCex = (Abc_Cex_t *)ABC_CALLOC( char, sizeof(Abc_Cex_t) + sizeof(unsigned) * Abc_BitWordNum(Info[4]) );
+        pCex->iPo    = Info[0];
+        pCex->iFrame = Info[1];
+        pCex->nRegs  = Info[2];
+        pCex->nPis   = Info[3];
+        pCex->nBits  = Info[4];
+        memcpy( pCex->pData, pSec->pData + 5 * sizeof(int), sizeof(unsigned) * Abc_BitWordNum(Info[4]) );
+        pSec->pObj = pCex;
+        return 1;
+    }
+    if ( !strcmp(pSec->pTag, "stats") )
+        return pSec->nSize == 12 * (int)sizeof(int);
+    // the sections written by later versions are skipped
+    return 1;
+}
+static void Abc_SessionFreeSec( Abc_Sec_t * pSec )
+{
+    if ( pSec->pObj == NULL )
+        return;
+    if ( !strcmp(pSec->pTag, "liblut") )
+        If_LibLutFree( (If_LibLut_t *)pSec->pObj );
+    else if ( !strcmp(pSec->pTag, "libscl") )
+        Abc_SclLibFree( (SC_Lib *)pSec->pObj );
+    else if ( !strcmp(pSec->pTag, "genlib") )
+    {
+        Mio_LibraryDelete( (Mio_Library_t *)pSec->pObj );
+        if ( pSec->pObj2 )
+            Amap_LibFree( (Amap_Lib_t *)pSec->pObj2 );
+    }
+    else if ( !strncmp(pSec->pTag, "gia", 3) )
+        Gia_ManStop( (Gia_Man_t *)pSec->pObj );
+    else if ( !strcmp(pSec->pTag, "cex") )
+        ABC_FREE( pSec->pObj );
+    pSec->pObj = pSec->pObj2 = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the contents of the session file into sections.]
+
+  Description [Returns NULL if the file is not a valid session file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t * Abc_SessionSplit( char * pContents, int nFileSize )
+{
+    Vec_Ptr_t * vSecs = Vec_PtrAlloc( 16 );
+    Abc_Sec_t * pSec;
+    char * pCur = pContents, * pEnd = pContents + nFileSize, * pStop;
+    // skip the comments (comment lines begin with '#' and end with '\n')
+    while ( pCur < pEnd && *pCur == '#' )
+        while ( pCur < pEnd && *pCur++ != '\n' );
+    while ( pCur < pEnd )
+    {
+        if ( (pStop = (char *)memchr( pCur, '\0', pEnd - pCur )) == NULL || pStop + 1 + sizeof(int) > pEnd )
+            break;
+        pSec = ABC_CALLOC( Abc_Sec_t, 1 );
+        Vec_PtrPush( vSecs, pSec );
+        pSec->pTag = pCur;
+        memcpy( &pSec->nSize, pStop + 1, sizeof(int) );
+        pSec->pData = pStop + 1 + sizeof(int);
+        if ( pSec->nSize < 0 || pSec->nSize > pEnd - pSec->pData )
+            break;
+        pCur = pSec->pData + pSec->nSize;
+        if ( !strcmp(pSec->pTag, "end") )
+            return vSecs;
+    }
+    Vec_PtrFreeFree( vSecs );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the state of the framework from a file.]
+
+  Description [The networks and the libraries of the framework are
+  replaced by those in the file.  All sections are checked, and all
+  of them except the networks are read, before the framework is changed,
+  so an invalid file leaves the framework as it was.  The networks are
+  read after the libraries are restored; if one of them cannot be read,
+  it is skipped.  Returns 1 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_FrameLoadSession( Abc_Frame_t * p, char * pFileName )
+{
+    Vec_Ptr_t * vSecs;
+    Abc_Sec_t * pSec;
+    Abc_Ntk_t * pNtk;
+    FILE * pFile;
+    char * pContents, * pCur;
+    int nFileSize, Version, i, RetValue = 1;
+    // read the file
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return 0;
+    }
+    nFileSize = Extra_FileSize( pFileName );
+    pContents = ABC_ALLOC( char, nFileSize + 1 );
+    if ( (int)fread( pContents, 1, nFileSize, pFile ) != nFileSize )
+        nFileSize = 0;
+    pContents[nFileSize] = 0;
+    fclose( pFile );
+    // split it into sections
+    vSecs = Abc_SessionSplit( pContents, nFileSize );
+    if ( vSecs == NULL || Vec_PtrSize(vSecs) < 2 || strcmp(((Abc_Sec_t *)Vec_PtrEntry(vSecs, 0))->pTag, "session") ||
+         ((Abc_Sec_t *)Vec_PtrEntry(vSecs, 0))->nSize != (int)sizeof(int) )
+    {
+        printf( "File \"%s\" is not a valid session file.\n", pFileName );
+        if ( vSecs ) Vec_PtrFreeFree( vSecs );
+        ABC_FREE( pContents );
+        return 0;
+    }
+    memcpy( &Version, ((Abc_Sec_t *)Vec_PtrEntry(vSecs, 0))->pData, sizeof(int) );
+    if ( Version != ABC_SESSION_VERSION )
+    {
+        printf( "Session file \"%s\" has unsupported version %d.\n", pFileName, Version );
+        Vec_PtrFreeFree( vSecs );
+        ABC_FREE( pContents );
+        return 0;
+    }
+    // check and read the sections
+    Vec_PtrForEachEntry( Abc_Sec_t *, vSecs, pSec, i )
+        if ( !Abc_SessionReadSec( pSec ) )
+        {
+            printf( "Session file \"%s\" has invalid section \"%s\".\n", pFileName, pSec->pTag );
+            Vec_PtrForEachEntry( Abc_Sec_t *, vSecs, pSec, i )
+                Abc_SessionFreeSec( pSec );
+            Vec_PtrFreeFree( vSecs );
+            ABC_FREE( pContents );
+            return 0;
+        }
+    // remove the networks before the libraries they may depend on are replaced
+    Abc_FrameDeleteAllNetworks( p );
+    if ( p->pNtkBest )
+        Abc_NtkDelete( p->pNtkBest );
+    p->pNtkBest = NULL;
+    Abc_NtkFraigStoreClean();
+    Abc_FrameClearVerifStatus( p );
+    // install the sections
+    Vec_PtrForEachEntry( Abc_Sec_t *, vSecs, pSec, i )
+    {
+        if ( !strcmp(pSec->pTag, "flags") )
+        {
+            for ( pCur = pSec->pData; pCur < pSec->pData + pSec->nSize; )
+            {
+                char * pKey = pCur, * pValue;
+                if ( st__delete( p->tFlags, (const char **)&pKey, &pValue ) )
+                {
+                    ABC_FREE( pKey );
+                    ABC_FREE( pValue );
+                }
+                pKey = pCur;  pCur += strlen(pCur) + 1;
+                st__insert( p->tFlags, Extra_UtilStrsav(pKey), Extra_UtilStrsav(pCur) );
+                pCur += strlen(pCur) + 1;
+            }
+        }
+        else if ( !strcmp(pSec->pTag, "liblut") )
+        {
+            If_LibLutFree( (If_LibLut_t *)Abc_FrameReadLibLut() );
+            Abc_FrameSetLibLut( pSec->pObj );
+        }
+        else if ( !strcmp(pSec->pTag, "libscl") )
+        {
+            if ( p->pLibScl )
+                Abc_SclLibFree( (SC_Lib *)p->pLibScl );
+            p->pLibScl = pSec->pObj;
+        }
+        else if ( !strcmp(pSec->pTag, "genlib") )
+        {
+            Mio_UpdateGenlib( (Mio_Library_t *)pSec->pObj );
+            Abc_FrameSetLibGen2( pSec->pObj2 );
+        }
+        else if ( !strcmp(pSec->pTag, "gia") )
+            p->pGia = (Gia_Man_t *)pSec->pObj;
+        else if ( !strcmp(pSec->pTag, "gia2") )
+            p->pGia2 = (Gia_Man_t *)pSec->pObj;
+        else if ( !strcmp(pSec->pTag, "giabest") )
+            p->pGiaBest = (Gia_Man_t *)pSec->pObj;
+        else if ( !strcmp(pSec->pTag, "giabest2") )
+            p->pGiaBest2 = (Gia_Man_t *)pSec->pObj;
+        else if ( !strcmp(pSec->pTag, "giasaved") )
+            p->pGiaSaved = (Gia_Man_t *)pSec->pObj;
+        else if ( !strcmp(pSec->pTag, "cex") )
+        {
+            Abc_Cex_t * pCex = (Abc_Cex_t *)pSec->pObj;
+            Abc_FrameReplaceCex( p, &pCex );
+        }
+        else if ( !strcmp(pSec->pTag, "stats") )
+        {
+            int pInfo[12];
+            memcpy( pInfo, pSec->pData, pSec->nSize );
+            p->Status         = pInfo[0];
+            p->nFrames        = pInfo[1];
+            memcpy( &p->nBestNtkArea,  pInfo + 2, sizeof(float) );
+            memcpy( &p->nBestNtkDelay, pInfo + 3, sizeof(float) );
+            p->nBestNtkNodes  = pInfo[4];
+            p->nBestNtkLevels = pInfo[5];
+            p->nBestLuts      = pInfo[6];
+            p->nBestEdges     = pInfo[7];
+            p->nBestLevels    = pInfo[8];
+            p->nBestLuts2     = pInfo[9];
+            p->nBestEdges2    = pInfo[10];
+            p->nBestLevels2   = pInfo[11];
+        }
+        pSec->pObj = pSec->pObj2 = NULL;
+    }
+    // read the networks using the restored libraries
+    Vec_PtrForEachEntry( Abc_Sec_t *, vSecs, pSec, i )
+    {
+        if ( strcmp(pSec->pTag, "ntk") && strcmp(pSec->pTag, "ntkbest") && strcmp(pSec->pTag, "store") )
+            continue;
+        if ( (pNtk = Abc_SessionReadNtk( pSec )) == NULL )
+        {
+            printf( "Restoring network \"%s\" has failed.\n", pSec->pTag );
+            RetValue = 0;
+        }
+        else if ( !strcmp(pSec->pTag, "ntk") )
+            Abc_FrameReplaceCurrentNetwork( p, pNtk );
+        else if ( !strcmp(pSec->pTag, "ntkbest") )
+            p->pNtkBest = pNtk;
+        else
+            Vec_PtrPush( p->vStore, pNtk );
+    }
+    Vec_PtrFreeFree( vSecs );
+    ABC_FREE( pContents );
+    return RetValue;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -51,6 +51,7 @@ struct Ver_Man_t_
     int             fMapped;       // mapped verilog
     int             fUseMemMan;    // allocate memory manager in the networks
     int             fCheck;        // checks network for currectness
+    int             nThreads;      // the number of threads parsing the modules
     // input file stream
     char *          pFileName;
     Ver_Stream_t *  pReader;
@@ -95,6 +96,7 @@ extern int            Ver_ParseSkipComments( Ver_Man_t * p );
 extern char *         Ver_ParseGetName( Ver_Man_t * p );
 /*=== verStream.c ========================================================*/
 extern Ver_Stream_t * Ver_StreamAlloc( char * pFileName );
+extern Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pBuffer, int nSize, int nLine );
 extern void           Ver_StreamFree( Ver_Stream_t * p );
 extern char *         Ver_StreamGetFileName( Ver_Stream_t * p );
 extern int            Ver_StreamGetFileSize( Ver_Stream_t * p );
@@ -21,6 +21,7 @@
 #include "ver.h"
 #include "map/mio/mio.h"
 #include "base/main/main.h"
+#include "misc/util/utilNam.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -55,6 +56,7 @@ static Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib );
 static void Ver_ParseStop( Ver_Man_t * p );
 static void Ver_ParseFreeData( Ver_Man_t * p );
 static void Ver_ParseInternal( Ver_Man_t * p );
+static int  Ver_ParseModulesPar( Ver_Man_t * p );
 static int  Ver_ParseModule( Ver_Man_t * p );
 static int  Ver_ParseSignal( Ver_Man_t * p, Abc_Ntk_t * pNtk, Ver_SignalType_t SigType );
 static int  Ver_ParseAlways( Ver_Man_t * p, Abc_Ntk_t * pNtk );
@@ -79,6 +81,8 @@ static inline int Ver_ObjIsConnected( Abc_Obj_t * pObj )   { assert( Abc_ObjIsBo
 
 int glo_fMapped = 0; // this is bad!
 
+#define VER_PAR_MODULES  64  // the min number of modules parsed by several threads
+
 typedef struct Ver_Bundle_t_    Ver_Bundle_t;
 struct Ver_Bundle_t_
 {
@@ -171,6 +175,7 @@ Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, i
     p->fMapped    = glo_fMapped;
     p->fCheck     = fCheck;
     p->fUseMemMan = fUseMemMan;
+    p->nThreads   = Abc_FrameReadFlag("verthreads") ? Abc_MinInt( 99, Abc_MaxInt( 1, atoi(Abc_FrameReadFlag("verthreads")) ) ) : 1;
     if ( glo_fMapped )
     {
         Hop_ManStop((Hop_Man_t *)p->pDesign->pManFunc);
@@ -204,25 +209,28 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
     int i;
 
     // preparse the modeles
-    pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
-    while ( 1 )
+    if ( pMan->nThreads < 2 || !Ver_ParseModulesPar( pMan ) )
     {
-        // get the next token
-        pToken = Ver_ParseGetName( pMan );
-        if ( pToken == NULL )
-            break;
-        if ( strcmp( pToken, "module" ) )
+        pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
+        while ( 1 )
         {
-            sprintf( pMan->sError, "Cannot read \"module\" directive." );
-            Ver_ParsePrintErrorMessage( pMan );
-            return;
+            // get the next token
+            pToken = Ver_ParseGetName( pMan );
+            if ( pToken == NULL )
+                break;
+            if ( strcmp( pToken, "module" ) )
+            {
+                sprintf( pMan->sError, "Cannot read \"module\" directive." );
+                Ver_ParsePrintErrorMessage( pMan );
+                return;
+            }
+            // parse the module
+            if ( !Ver_ParseModule(pMan) )
+                return;
         }
-        // parse the module
-        if ( !Ver_ParseModule(pMan) )
-            return;
+        Extra_ProgressBarStop( pMan->pProgress );
+        pMan->pProgress = NULL;
     }
-    Extra_ProgressBarStop( pMan->pProgress );
-    pMan->pProgress = NULL;
 
     // process defined and undefined boxes
     if ( !Ver_ParseAttachBoxes( pMan ) )
@@ -244,6 +252,299 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the modules of the file loaded into memory.]
+
+  Description [Records the offset of the "module" keyword and its line 
+  number for each module. The names of the modules are added to pNames.
+  Returns 0 if the file does not look like a sequence of modules with 
+  unique names; such files are left to the serial parser, which reports 
+  the problem.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Ver_ParseIsSpace( char c )  { return c == ' ' || c == '\t' || c == '\n' || c == '\r';                    }
+static inline int Ver_ParseIsStop( char c )   { return Ver_ParseIsSpace(c) || c == '(' || c == ')' || c == ',' || c == ';'; }
+
+int Ver_ParsePrescan( char * pBuffer, int nSize, Vec_Int_t * vStarts, Vec_Int_t * vLines, Abc_Nam_t * pNames )
+{
+    char * pCur = pBuffer, * pEnd = pBuffer + nSize, * pWord;
+    int nLines = 1, State = 0, fFound; // 0 = before "module"; 1 = before the name; 2 = inside the module
+    while ( 1 )
+    {
+        // skip spaces and comments
+        while ( pCur < pEnd )
+        {
+            if ( Ver_ParseIsSpace(*pCur) )
+                nLines += (*pCur++ == '\n');
+            else if ( pCur + 1 < pEnd && pCur[0] == '/' && pCur[1] == '/' )
+                while ( pCur < pEnd && *pCur != '\n' )
+                    pCur++;
+            else if ( pCur + 1 < pEnd && pCur[0] == '/' && pCur[1] == '*' )
+            {
+                for ( pCur += 2; pCur + 1 < pEnd && (pCur[0] != '*' || pCur[1] != '/'); pCur++ )
+                    nLines += (*pCur == '\n');
+                if ( pCur + 1 >= pEnd )
+                    return 0;
+                pCur += 2;
+            }
+            else
+                break;
+        }
+        if ( pCur == pEnd )
+            return State == 0;
+        // get the next word
+        pWord = pCur;
+        if ( *pCur == '\\' ) // escaped name
+            while ( pCur < pEnd && !Ver_ParseIsSpace(*pCur) )
+                pCur++;
+        else if ( Ver_ParseIsStop(*pCur) ) 
+        {
+            pCur++;
+            continue;
+        }
+        else
+            while ( pCur < pEnd && !Ver_ParseIsStop(*pCur) )
+                pCur++;
+        if ( State == 0 )
+        {
+            if ( pCur - pWord != 6 || strncmp(pWord, "module", 6) )
+                return 0;
+            Vec_IntPush( vStarts, pWord - pBuffer );
+            Vec_IntPush( vLines, nLines );
+            State = 1;
+        }
+        else if ( State == 1 )
+        {
+            Abc_NamStrFindOrAddLim( pNames, pWord + (*pWord == '\\'), pCur, &fFound );
+            if ( fFound )
+                return 0;
+            State = 2;
+        }
+        else if ( pCur - pWord == 9 && !strncmp(pWord, "endmodule", 9) )
+            State = 0;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the parser of a chunk of the file.]
+
+  Description [The chunk is parsed into a separate design. Errors are not 
+  printed because the serial parser is run again if the chunk fails.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Man_t * Ver_ParseStartChunk( Ver_Man_t * pMan, char * pBuffer, int nSize, int nLine )
+{
+    Ver_Man_t * p;
+    p = ABC_ALLOC( Ver_Man_t, 1 );
+    memset( p, 0, sizeof(Ver_Man_t) );
+    p->pFileName  = pMan->pFileName;
+    p->pReader    = Ver_StreamAllocMem( pMan->pFileName, pBuffer, nSize, nLine );
+    p->fMapped    = pMan->fMapped;
+    p->fCheck     = pMan->fCheck;
+    p->fUseMemMan = pMan->fUseMemMan;
+    p->nThreads   = 1;
+    p->Output     = NULL;
+    p->vNames     = Vec_PtrAlloc( 100 );
+    p->vStackFn   = Vec_PtrAlloc( 100 );
+    p->vStackOp   = Vec_IntAlloc( 100 );
+    p->vPerm      = Vec_IntAlloc( 100 );
+    p->pDesign    = Abc_DesCreate( pMan->pFileName );
+    p->pDesign->pLibrary = pMan->pDesign->pLibrary;
+    p->pDesign->pGenlib  = pMan->pDesign->pGenlib;
+    if ( pMan->pDesign->pManFunc == NULL )
+    {
+        Hop_ManStop( (Hop_Man_t *)p->pDesign->pManFunc );
+        p->pDesign->pManFunc = NULL;
+    }
+    return p;
+}
+int Ver_ParseChunk( void * pArg )
+{
+    Ver_Man_t * p = (Ver_Man_t *)pArg;
+    char * pToken;
+    while ( (pToken = Ver_ParseGetName( p )) )
+    {
+        if ( strcmp( pToken, "module" ) || !Ver_ParseModule( p ) )
+        {
+            p->fError = 1;
+            break;
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the module parsed by the chunk parser into the design.]
+
+  Description [Returns the module that should be deleted: the module 
+  itself if it is only a reference to a module defined elsewhere, or the 
+  reference to this module seen earlier.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Ver_ParseMergeModule( Abc_Des_t * pDesign, Abc_Des_t * pChunk, Abc_Ntk_t * pNtk )
+{
+    Abc_Ntk_t * pNtkOld = Abc_DesFindModelByName( pDesign, pNtk->pName );
+    Abc_Obj_t * pObj;
+    char * pKey;
+    int i;
+    // undefined modules are referenced by the boxes and have no objects
+    if ( pNtkOld && Abc_NtkObjNum(pNtk) == 0 )
+        return pNtk;
+    assert( pNtkOld == NULL || Abc_NtkObjNum(pNtkOld) == 0 );
+    // transfer the local functions
+    if ( pNtk->ntkFunc == ABC_FUNC_AIG && pNtk->pManFunc != pDesign->pManFunc )
+    {
+        Abc_NtkForEachNode( pNtk, pObj, i )
+            pObj->pData = Hop_Transfer( (Hop_Man_t *)pChunk->pManFunc, (Hop_Man_t *)pDesign->pManFunc, (Hop_Obj_t *)pObj->pData, Abc_ObjFaninNum(pObj) );
+        pNtk->pManFunc = pDesign->pManFunc;
+    }
+    if ( pNtkOld == NULL )
+    {
+        pNtk->Id = 0;
+        Abc_DesAddModel( pDesign, pNtk );
+        return NULL;
+    }
+    // replace the reference seen earlier, keeping its place in the design
+    pKey = pNtkOld->pName;
+    st__delete( pDesign->tModules, (const char **)&pKey, NULL );
+    st__insert( pDesign->tModules, (char *)pNtk->pName, (char *)pNtk );
+    pNtk->Id = pNtkOld->Id;
+    pNtk->pDesign = pDesign;
+    Vec_PtrWriteEntry( pDesign->vModules, pNtk->Id, pNtk );
+    return pNtkOld;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the modules using several threads.]
+
+  Description [The file is loaded into memory and divided into chunks of 
+  consecutive modules, which are parsed concurrently into separate 
+  designs. The designs are merged in the order of the chunks, so the 
+  modules appear in the same order as in the serial parser, and the 
+  boxes are redirected to the modules of the merged design. Returns 0 
+  if the serial parser should be used instead: the file is too small, 
+  its structure is not recognized, or one of the chunks has failed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParseModulesPar( Ver_Man_t * pMan )
+{
+    Abc_Des_t * pDesign = pMan->pDesign;
+    Abc_Nam_t * pNames = Abc_NamStart( 1000, 20 );
+    Vec_Int_t * vStarts = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vLines = Vec_IntAlloc( 1000 );
+    Vec_Ptr_t * vJobs = NULL, * vDrop = NULL;
+    Ver_Man_t * p;
+    Abc_Ntk_t * pNtk, * pNtkDrop;
+    Abc_Obj_t * pBox;
+    FILE * pFile;
+    char * pBuffer;
+    int i, k, m, nSize, nJobs, iStart, fFound, RetValue;
+    // load the file
+    nSize = Ver_StreamGetFileSize( pMan->pReader );
+    pBuffer = ABC_ALLOC( char, nSize + 1 );
+    pFile = fopen( pMan->pFileName, "rb" );
+    RetValue = pFile && (int)fread( pBuffer, 1, nSize, pFile ) == nSize;
+    if ( pFile )
+        fclose( pFile );
+    pBuffer[nSize] = 0;
+    // find the modules
+    if ( !RetValue || !Ver_ParsePrescan( pBuffer, nSize, vStarts, vLines, pNames ) || Vec_IntSize(vStarts) < VER_PAR_MODULES )
+    {
+        RetValue = 0;
+        goto finish;
+    }
+    // create chunks of consecutive modules with similar sizes
+    vJobs = Vec_PtrAlloc( 4 * pMan->nThreads );
+    nJobs = Abc_MinInt( Vec_IntSize(vStarts), 4 * pMan->nThreads );
+    for ( i = iStart = 0, m = 1; m <= Vec_IntSize(vStarts); m++ )
+    {
+        int iStop = m == Vec_IntSize(vStarts) ? nSize : Vec_IntEntry(vStarts, m);
+        if ( m < Vec_IntSize(vStarts) && (iword)iStop * nJobs < (iword)nSize * (Vec_PtrSize(vJobs) + 1) )
+            continue;
+        p = Ver_ParseStartChunk( pMan, pBuffer + iStart, iStop - iStart, i ? Vec_IntEntry(vLines, i) : 1 );
+        Vec_PtrPush( vJobs, p );
+        iStart = iStop;
+        i = m;
+    }
+    // parse the chunks
+    Util_ProcessThreads( Ver_ParseChunk, vJobs, pMan->nThreads + 1, 0, 0 );
+    RetValue = 0;
+    Vec_PtrForEachEntry( Ver_Man_t *, vJobs, p, i )
+        if ( p->fError )
+            goto finish;
+    // make sure that each module is defined only once
+    Abc_NamStop( pNames );
+    pNames = Abc_NamStart( 1000, 20 );
+    Vec_PtrForEachEntry( Ver_Man_t *, vJobs, p, i )
+        Vec_PtrForEachEntry( Abc_Ntk_t *, p->pDesign->vModules, pNtk, k )
+        {
+            if ( Abc_NtkObjNum(pNtk) == 0 )
+                continue;
+            Abc_NamStrFindOrAdd( pNames, pNtk->pName, &fFound );
+            if ( fFound )
+                goto finish;
+        }
+    // merge the designs
+    vDrop = Vec_PtrAlloc( 100 );
+    Vec_PtrForEachEntry( Ver_Man_t *, vJobs, p, i )
+    {
+        Vec_PtrForEachEntry( Abc_Ntk_t *, p->pDesign->vModules, pNtk, k )
+            if ( (pNtkDrop = Ver_ParseMergeModule( pDesign, p->pDesign, pNtk )) )
+                Vec_PtrPush( vDrop, pNtkDrop );
+        Vec_PtrClear( p->pDesign->vModules );
+    }
+    // redirect the boxes to the modules of the design
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pDesign->vModules, pNtk, i )
+        Abc_NtkForEachBox( pNtk, pBox, k )
+            if ( Abc_ObjIsBlackbox(pBox) && pBox->pData )
+                pBox->pData = Abc_DesFindModelByName( pDesign, ((Abc_Ntk_t *)pBox->pData)->pName );
+    Vec_PtrForEachEntry( Abc_Ntk_t *, vDrop, pNtk, i )
+    {
+        pNtk->pDesign = NULL;
+        Abc_NtkDelete( pNtk );
+    }
+    RetValue = 1;
+finish:
+    if ( vJobs )
+    {
+        Vec_PtrForEachEntry( Ver_Man_t *, vJobs, p, i )
+        {
+            if ( p->pDesign )
+                Abc_DesFree( p->pDesign, NULL );
+            p->pDesign = NULL;
+            Ver_ParseStop( p );
+        }
+        Vec_PtrFree( vJobs );
+    }
+    Vec_PtrFreeP( &vDrop );
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vLines );
+    Abc_NamStop( pNames );
+    ABC_FREE( pBuffer );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [File parser.]
@@ -278,7 +579,9 @@ void Ver_ParseFreeData( Ver_Man_t * p )
 void Ver_ParsePrintErrorMessage( Ver_Man_t * p )
 {
     p->fError = 1;
-    if ( p->fTopLevel ) // the line number is not given
+    if ( p->Output == NULL ) // the chunk is parsed again by the serial parser, which reports the error
+        ;
+    else if ( p->fTopLevel ) // the line number is not given
         fprintf( p->Output, "%s: %s\n", p->pFileName, p->sError );
     else // print the error message with the line number
         fprintf( p->Output, "%s (line %d): %s\n", 
@@ -110,6 +110,36 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the reader for the part of the file already in memory.]
+
+  Description [The buffer is not copied and should not be changed or 
+  deallocated while the reader is used. The line counter starts from 
+  nLine, which is the line number of the first character in the buffer.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pBuffer, int nSize, int nLine )
+{
+    Ver_Stream_t * p;
+    p = ABC_ALLOC( Ver_Stream_t, 1 );
+    memset( p, 0, sizeof(Ver_Stream_t) );
+    p->pFileName   = pFileName;
+    p->nFileSize   = nSize;
+    p->nFileRead   = nSize;
+    p->pBuffer     = pBuffer;
+    p->nBufferSize = nSize;
+    p->pBufferCur  = pBuffer;
+    p->pBufferEnd  = pBuffer + nSize;
+    p->pBufferStop = p->pBufferEnd; // the data is never reloaded
+    p->nLineCounter = nLine;
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Loads new data into the file reader.]
@@ -156,9 +186,11 @@ void Ver_StreamReload( Ver_Stream_t * p )
 ***********************************************************************/
 void Ver_StreamFree( Ver_Stream_t * p )
 {
-    if ( p->pFile )
+    if ( p->pFile ) // the readers started by Ver_StreamAllocMem() do not own the buffer
+    {
         fclose( p->pFile );
-    ABC_FREE( p->pBuffer );
+        ABC_FREE( p->pBuffer );
+    }
     ABC_FREE( p );
 }
 
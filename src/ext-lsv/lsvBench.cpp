@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <map>
+#include <string>
+
+#include "base/io/ioAbc.h"
+#include "ext-lsv/lsvInt.h"
+
+// the columns of the benchmark table
+static const char* s_BenchHeader =
+    "name,mode,k,l,threads,ands,levels,cuts,mocuts,read,derive,enum,collect,print,total,store_mb,peak_mb";
+
+// resets the peak resident set size of the process (Linux only)
+static void Lsv_BenchResetPeak() {
+#ifdef __linux__
+  FILE* pFile = fopen("/proc/self/clear_refs", "w");
+  if (pFile == NULL) return;
+  fputs("5", pFile);
+  fclose(pFile);
+#endif
+}
+
+// returns the peak resident set size of the process in MB (Linux only)
+static double Lsv_BenchPeakMem() {
+  double Peak = 0;
+#ifdef __linux__
+  char Buffer[256];
+  FILE* pFile = fopen("/proc/self/status", "r");
+  if (pFile == NULL) return 0;
+  while (fgets(Buffer, sizeof(Buffer), pFile))
+    if (!strncmp(Buffer, "VmHWM:", 6)) Peak = atof(Buffer + 6) / (1 << 10);
+  fclose(pFile);
+#endif
+  return Peak;
+}
+
+static inline double Lsv_BenchSec(abctime clk) { return 1.0 * clk / CLOCKS_PER_SEC; }
+
+// runs one mode on the strashed network and fills the row
+static int Lsv_BenchRunMode(Abc_Ntk_t* pNtk, const char* pMode, Lsv_MoCutPar_t* pPars, Lsv_BenchRow_t* pRow) {
+  Lsv_MoCutStats_t Stats;
+  Lsv_MoCuts_t MoCuts;
+  Gia_Man_t* pGia = NULL;
+  Vec_Int_t* vMap = NULL;
+  abctime clk, clkTotal = Abc_Clock();
+  FILE* pFile = tmpfile();
+  int RetValue = 0;
+  if (pFile == NULL) return 1;
+  memset(&Stats, 0, sizeof(Stats));
+  pPars->pStats = &Stats;
+  pRow->TimeDerive = pRow->TimePrint = 0;
+  if (!strcmp(pMode, "gia")) {
+    clk = Abc_Clock();
+    pGia = Lsv_NtkToGia(pNtk, &vMap);
+    pRow->TimeDerive = Lsv_BenchSec(Abc_Clock() - clk);
+    Lsv_GiaComputeMoCuts(pGia, pPars, vMap, &MoCuts);
+    Gia_ManStop(pGia);
+    Vec_IntFree(vMap);
+  } else if (!strcmp(pMode, "ntk"))
+    Lsv_NtkComputeMoCuts(pNtk, pPars, &MoCuts);
+  else
+    RetValue = Lsv_NtkStreamMoCuts(pNtk, pPars, pFile);
+  if (strcmp(pMode, "stream")) {
+    clk = Abc_Clock();
+    Lsv_MoCutsPrint(pFile, &MoCuts, NULL);
+    fflush(pFile);
+    pRow->TimePrint = Lsv_BenchSec(Abc_Clock() - clk);
+  }
+  fclose(pFile);
+  pPars->pStats = NULL;
+  pRow->TimeTotal = Lsv_BenchSec(Abc_Clock() - clkTotal);
+  pRow->Mode = pMode;
+  pRow->nLevels = Stats.nLevels;
+  pRow->nCuts = Stats.nCuts;
+  pRow->nMoCuts = Stats.nMoCuts;
+  pRow->TimeEnum = Lsv_BenchSec(Stats.clkEnum);
+  pRow->TimeCollect = Lsv_BenchSec(Stats.clkCollect);
+  pRow->MemSto = Stats.MemSto / (1 << 20);
+  return RetValue;
+}
+
+// runs the in-memory, the &-space and the streaming enumeration on one
+// benchmark; every mode is run nRepeats times and the fastest run is kept;
+// returns 0 on success
+int Lsv_BenchRun(char* pFileName, Lsv_MoCutPar_t* pPars, int nRepeats, std::vector<Lsv_BenchRow_t>* pvRows) {
+  static const char* s_Modes[3] = {"ntk", "gia", "stream"};
+  Abc_Ntk_t *pNtkRead, *pNtk;
+  Lsv_BenchRow_t Row;
+  abctime clk;
+  int i, r;
+  Lsv_BenchResetPeak();
+  clk = Abc_Clock();
+  pNtkRead = Io_Read(pFileName, Io_ReadFileType(pFileName), 1, 0);
+  if (pNtkRead == NULL) return 1;
+  Row.TimeRead = Lsv_BenchSec(Abc_Clock() - clk);
+  clk = Abc_Clock();
+  pNtk = Abc_NtkIsStrash(pNtkRead) ? Abc_NtkDup(pNtkRead) : Abc_NtkStrash(pNtkRead, 0, 1, 0);
+  Abc_NtkDelete(pNtkRead);
+  if (pNtk == NULL) return 1;
+  abctime clkStrash = Abc_Clock() - clk;
+  Row.Name = Extra_FileNameWithoutPath(pFileName);
+  Row.nCutSize = pPars->nCutSize;
+  Row.nOutMin = pPars->nOutMin;
+  Row.nThreads = pPars->nThreads;
+  Row.nAnds = Abc_NtkNodeNum(pNtk);
+  for (i = 0; i < 3; i++) {
+    Lsv_BenchRow_t Best;
+    for (r = 0; r < nRepeats; r++) {
+      Lsv_BenchRow_t Run = Row;
+      Lsv_BenchResetPeak();
+      if (Lsv_BenchRunMode(pNtk, s_Modes[i], pPars, &Run)) {
+        Abc_NtkDelete(pNtk);
+        return 1;
+      }
+      Run.TimeDerive += Lsv_BenchSec(clkStrash);
+      Run.TimeTotal += Run.TimeRead + Lsv_BenchSec(clkStrash);
+      Run.MemPeak = Lsv_BenchPeakMem();
+      if (r == 0 || Run.TimeTotal < Best.TimeTotal) Best = Run;
+    }
+    pvRows->push_back(Best);
+  }
+  Abc_NtkDelete(pNtk);
+  return 0;
+}
+
+void Lsv_BenchWriteCsv(FILE* pFile, const std::vector<Lsv_BenchRow_t>& vRows) {
+  fprintf(pFile, "%s\n", s_BenchHeader);
+  for (const Lsv_BenchRow_t& Row : vRows)
+    fprintf(pFile, "%s,%s,%d,%d,%d,%d,%d,%ld,%ld,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.2f,%.2f\n", Row.Name.c_str(),
+            Row.Mode.c_str(), Row.nCutSize, Row.nOutMin, Row.nThreads, Row.nAnds, Row.nLevels, Row.nCuts,
+            Row.nMoCuts, Row.TimeRead, Row.TimeDerive, Row.TimeEnum, Row.TimeCollect, Row.TimePrint,
+            Row.TimeTotal, Row.MemSto, Row.MemPeak);
+}
+
+// reads the table written by Lsv_BenchWriteCsv; returns 0 on success
+int Lsv_BenchReadCsv(char* pFileName, std::vector<Lsv_BenchRow_t>* pvRows) {
+  char Buffer[1000], Name[500], Mode[100];
+  FILE* pFile = fopen(pFileName, "r");
+  int Line = 0;
+  if (pFile == NULL) return 1;
+  while (fgets(Buffer, sizeof(Buffer), pFile)) {
+    Lsv_BenchRow_t Row;
+    if (Line++ == 0 || Buffer[0] == '\n') continue;
+    if (sscanf(Buffer, "%499[^,],%99[^,],%d,%d,%d,%d,%d,%ld,%ld,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf", Name, Mode,
+               &Row.nCutSize, &Row.nOutMin, &Row.nThreads, &Row.nAnds, &Row.nLevels, &Row.nCuts, &Row.nMoCuts,
+               &Row.TimeRead, &Row.TimeDerive, &Row.TimeEnum, &Row.TimeCollect, &Row.TimePrint, &Row.TimeTotal,
+               &Row.MemSto, &Row.MemPeak) != 17) {
+      Abc_Print(-1, "Cannot parse line %d of the baseline \"%s\".\n", Line, pFileName);
+      fclose(pFile);
+      return 1;
+    }
+    Row.Name = Name;
+    Row.Mode = Mode;
+    pvRows->push_back(Row);
+  }
+  fclose(pFile);
+  return 0;
+}
+
+static std::string Lsv_BenchKey(const Lsv_BenchRow_t& Row) {
+  char Buffer[100];
+  snprintf(Buffer, sizeof(Buffer), ",%d,%d,%d", Row.nCutSize, Row.nOutMin, Row.nThreads);
+  return Row.Name + "," + Row.Mode + Buffer;
+}
+
+// compares the rows against the baseline and prints the table; a row
+// regresses if its cut counts differ or if its time or its store memory
+// grows by more than Tolerance percent (ignoring changes below the noise
+// floor); the peak memory of the process is only reported because the
+// heap keeps the memory freed by the previous benchmarks; returns the
+// number of regressions
+int Lsv_BenchCompare(const std::vector<Lsv_BenchRow_t>& vRows, const std::vector<Lsv_BenchRow_t>& vBase,
+                     int Tolerance) {
+  std::map<std::string, const Lsv_BenchRow_t*> Base;
+  double Ratio = 1.0 + 0.01 * Tolerance;
+  int nRegress = 0, nMissing = 0;
+  for (const Lsv_BenchRow_t& Row : vBase) Base[Lsv_BenchKey(Row)] = &Row;
+  printf("%-16s %-6s %10s %10s %7s %9s %9s %9s  %s\n", "Name", "Mode", "Time", "Base", "Ratio", "Store MB", "Base MB",
+         "Peak MB", "Status");
+  for (const Lsv_BenchRow_t& Row : vRows) {
+    auto it = Base.find(Lsv_BenchKey(Row));
+    if (it == Base.end()) {
+      printf("%-16s %-6s %10.4f %10s %7s %9.2f %9s %9.2f  new\n", Row.Name.c_str(), Row.Mode.c_str(), Row.TimeTotal,
+             "-", "-", Row.MemSto, "-", Row.MemPeak);
+      nMissing++;
+      continue;
+    }
+    const Lsv_BenchRow_t* pBase = it->second;
+    const char* pStatus = "ok";
+    if (Row.nCuts != pBase->nCuts || Row.nMoCuts != pBase->nMoCuts)
+      pStatus = "MISMATCH";
+    else if (Row.TimeTotal > pBase->TimeTotal * Ratio && Row.TimeTotal - pBase->TimeTotal > 0.1)
+      pStatus = "SLOWER";
+    else if (Row.MemSto > pBase->MemSto * Ratio && Row.MemSto - pBase->MemSto > 1.0)
+      pStatus = "MEMORY";
+    nRegress += strcmp(pStatus, "ok") != 0;
+    printf("%-16s %-6s %10.4f %10.4f %7.2f %9.2f %9.2f %9.2f  %s\n", Row.Name.c_str(), Row.Mode.c_str(),
+           Row.TimeTotal, pBase->TimeTotal, pBase->TimeTotal > 0 ? Row.TimeTotal / pBase->TimeTotal : 1.0, Row.MemSto,
+           pBase->MemSto, Row.MemPeak, pStatus);
+  }
+  printf("Rows = %d. Regressions = %d. Not in the baseline = %d.\n", (int)vRows.size(), nRegress, nMissing);
+  return nRegress;
+}
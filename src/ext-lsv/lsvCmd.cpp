@@ -1,11 +1,18 @@
 #include "base/abc/abc.h"
 #include "base/main/main.h"
 #include "base/main/mainInt.h"
+#include "ext-lsv/lsvInt.h"
 
 static int Lsv_CommandPrintNodes(Abc_Frame_t* pAbc, int argc, char** argv);
+static int Lsv_CommandPrintMoCut(Abc_Frame_t* pAbc, int argc, char** argv);
+static int Lsv_CommandGiaPrintMoCut(Abc_Frame_t* pAbc, int argc, char** argv);
+static int Lsv_CommandBench(Abc_Frame_t* pAbc, int argc, char** argv);
 
 void init(Abc_Frame_t* pAbc) {
   Cmd_CommandAdd(pAbc, "LSV", "lsv_print_nodes", Lsv_CommandPrintNodes, 0);
+  Cmd_CommandAdd(pAbc, "LSV", "lsv_printmocut", Lsv_CommandPrintMoCut, 0);
+  Cmd_CommandAdd(pAbc, "LSV", "&lsv_printmocut", Lsv_CommandGiaPrintMoCut, 0);
+  Cmd_CommandAdd(pAbc, "LSV", "lsv_bench", Lsv_CommandBench, 0);
 }
 
 void destroy(Abc_Frame_t* pAbc) {}
@@ -57,4 +64,401 @@ usage:
   Abc_Print(-2, "\t        prints the nodes in the network\n");
   Abc_Print(-2, "\t-h    : print the command usage\n");
   return 1;
-}
\ No newline at end of file
+}
+
+int Lsv_CommandPrintMoCut(Abc_Frame_t* pAbc, int argc, char** argv) {
+  Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
+  Lsv_MoCutPar_t Pars, *pPars = &Pars;
+  char* pFileName = NULL;
+  FILE* pFile;
+  Gia_Man_t* pGia = NULL;
+  Vec_Int_t* vMap = NULL;
+  int c, RetValue, fGia = 0, fClasses = 0;
+  Lsv_MoCutSetDefaultPars(pPars);
+  Extra_UtilGetoptReset();
+  while ((c = Extra_UtilGetopt(argc, argv, "pMFsgtcvh")) != EOF) {
+    switch (c) {
+      case 'p':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-p\" should be followed by an integer.\n");
+          goto usage;
+        }
+        pPars->nThreads = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (pPars->nThreads < 1) goto usage;
+        break;
+      case 'M':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-M\" should be followed by an integer.\n");
+          goto usage;
+        }
+        pPars->nStreamMem = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (pPars->nStreamMem < 1) goto usage;
+        break;
+      case 'F':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-F\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pFileName = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
+      case 's':
+        pPars->fStream ^= 1;
+        break;
+      case 'g':
+        fGia ^= 1;
+        break;
+      case 't':
+        pPars->fTruth ^= 1;
+        break;
+      case 'c':
+        fClasses ^= 1;
+        break;
+      case 'v':
+        pPars->fVerbose ^= 1;
+        break;
+      case 'h':
+        goto usage;
+      default:
+        goto usage;
+    }
+  }
+  if (argc != globalUtilOptind + 2) {
+    Abc_Print(-1, "Expecting the cut size and the number of outputs.\n");
+    goto usage;
+  }
+  pPars->nCutSize = atoi(argv[globalUtilOptind]);
+  pPars->nOutMin = atoi(argv[globalUtilOptind + 1]);
+  if (pPars->nCutSize < 1 || pPars->nCutSize > LSV_CUT_SIZE_MAX) {
+    Abc_Print(-1, "The cut size should be between 1 and %d.\n", LSV_CUT_SIZE_MAX);
+    return 1;
+  }
+  if (pPars->nOutMin < 1) {
+    Abc_Print(-1, "The number of outputs should be at least 1.\n");
+    return 1;
+  }
+  if (!pNtk) {
+    Abc_Print(-1, "Empty network.\n");
+    return 1;
+  }
+  if (!Abc_NtkIsStrash(pNtk)) {
+    Abc_Print(-1, "The network is not an AIG (run \"strash\").\n");
+    return 1;
+  }
+  if (fGia) pGia = Lsv_NtkToGia(pNtk, &vMap);
+  if (!pPars->fStream) {
+    Lsv_MoCuts_t MoCuts;
+    if (pFileName) Abc_Print(0, "The output file is only used in the streaming mode (-s).\n");
+    pPars->fTruth |= fClasses;
+    if (pGia) {
+      Lsv_GiaComputeMoCuts(pGia, pPars, vMap, &MoCuts);
+      Gia_ManStop(pGia);
+      Vec_IntFree(vMap);
+    } else
+      Lsv_NtkComputeMoCuts(pNtk, pPars, &MoCuts);
+    if (fClasses)
+      Lsv_MoCutsPrintClasses(stdout, &MoCuts);
+    else
+      Lsv_MoCutsPrint(stdout, &MoCuts, NULL);
+    return 0;
+  }
+  if (pPars->fTruth || fClasses) Abc_Print(0, "The functions are not computed in the streaming mode (-s).\n");
+  pFile = pFileName ? fopen(pFileName, "w") : stdout;
+  if (pFile == NULL) {
+    Abc_Print(-1, "Cannot open output file \"%s\".\n", pFileName);
+    if (pGia) Gia_ManStop(pGia), Vec_IntFree(vMap);
+    return 1;
+  }
+  if (pGia) {
+    RetValue = Lsv_GiaStreamMoCuts(pGia, pPars, vMap, pFile);
+    Gia_ManStop(pGia);
+    Vec_IntFree(vMap);
+  } else
+    RetValue = Lsv_NtkStreamMoCuts(pNtk, pPars, pFile);
+  if (pFileName && fclose(pFile) != 0 && RetValue == 0) {
+    Abc_Print(-1, "Cannot write output file \"%s\".\n", pFileName);
+    RetValue = 1;
+  }
+  return RetValue;
+
+usage:
+  Abc_Print(-2, "usage: lsv_printmocut [-pM num] [-F file] [-sgtcvh] <k> <l>\n");
+  Abc_Print(-2, "\t         prints the k-feasible cuts shared by at least l nodes\n");
+  Abc_Print(-2, "\t-p num  : the number of threads enumerating each level [default = %d]\n", pPars->nThreads);
+  Abc_Print(-2, "\t-M num  : the memory for buffering cuts in the streaming mode (MB) [default = %d]\n", pPars->nStreamMem);
+  Abc_Print(-2, "\t-F file : the output file in the streaming mode [default = stdout]\n");
+  Abc_Print(-2, "\t-s      : toggle streaming the cuts through sorted runs [default = %s]\n", pPars->fStream ? "yes" : "no");
+  Abc_Print(-2, "\t-g      : toggle enumerating on the AIG in the &-space [default = %s]\n", fGia ? "yes" : "no");
+  Abc_Print(-2, "\t-t      : toggle printing the truth tables of the outputs [default = %s]\n", pPars->fTruth ? "yes" : "no");
+  Abc_Print(-2, "\t-c      : toggle printing the NPN classes instead of the cuts [default = %s]\n", fClasses ? "yes" : "no");
+  Abc_Print(-2, "\t-v      : toggle printing runtime statistics [default = %s]\n", pPars->fVerbose ? "yes" : "no");
+  Abc_Print(-2, "\t-h      : print the command usage\n");
+  Abc_Print(-2, "\t<k>     : the max number of cut leaves (1 <= k <= %d)\n", LSV_CUT_SIZE_MAX);
+  Abc_Print(-2, "\t<l>     : the min number of nodes sharing a cut\n");
+  return 1;
+}
+
+int Lsv_CommandGiaPrintMoCut(Abc_Frame_t* pAbc, int argc, char** argv) {
+  Gia_Man_t* pGia = pAbc->pGia;
+  Lsv_MoCutPar_t Pars, *pPars = &Pars;
+  char* pFileName = NULL;
+  FILE* pFile;
+  int c, RetValue, fNames = 0;
+  Lsv_MoCutSetDefaultPars(pPars);
+  Extra_UtilGetoptReset();
+  while ((c = Extra_UtilGetopt(argc, argv, "pMFsntvh")) != EOF) {
+    switch (c) {
+      case 'p':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-p\" should be followed by an integer.\n");
+          goto usage;
+        }
+        pPars->nThreads = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (pPars->nThreads < 1) goto usage;
+        break;
+      case 'M':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-M\" should be followed by an integer.\n");
+          goto usage;
+        }
+        pPars->nStreamMem = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (pPars->nStreamMem < 1) goto usage;
+        break;
+      case 'F':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-F\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pFileName = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
+      case 's':
+        pPars->fStream ^= 1;
+        break;
+      case 'n':
+        fNames ^= 1;
+        break;
+      case 't':
+        pPars->fTruth ^= 1;
+        break;
+      case 'v':
+        pPars->fVerbose ^= 1;
+        break;
+      case 'h':
+        goto usage;
+      default:
+        goto usage;
+    }
+  }
+  if (argc != globalUtilOptind + 2) {
+    Abc_Print(-1, "Expecting the cut size and the number of outputs.\n");
+    goto usage;
+  }
+  pPars->nCutSize = atoi(argv[globalUtilOptind]);
+  pPars->nOutMin = atoi(argv[globalUtilOptind + 1]);
+  if (pPars->nCutSize < 1 || pPars->nCutSize > LSV_CUT_SIZE_MAX) {
+    Abc_Print(-1, "The cut size should be between 1 and %d.\n", LSV_CUT_SIZE_MAX);
+    return 1;
+  }
+  if (pPars->nOutMin < 1) {
+    Abc_Print(-1, "The number of outputs should be at least 1.\n");
+    return 1;
+  }
+  if (pGia == NULL) {
+    Abc_Print(-1, "There is no AIG.\n");
+    return 1;
+  }
+  if (!Lsv_GiaCheckAig(pGia)) {
+    Abc_Print(-1, "The AIG has buffers or XOR/MUX nodes.\n");
+    return 1;
+  }
+  if (!pPars->fStream) {
+    if (pFileName) Abc_Print(0, "The output file is only used in the streaming mode (-s).\n");
+    Lsv_GiaPrintMoCuts(pGia, pPars, fNames);
+    return 0;
+  }
+  if (fNames) Abc_Print(0, "The CI names are not printed in the streaming mode (-s).\n");
+  if (pPars->fTruth) Abc_Print(0, "The functions are not computed in the streaming mode (-s).\n");
+  pFile = pFileName ? fopen(pFileName, "w") : stdout;
+  if (pFile == NULL) {
+    Abc_Print(-1, "Cannot open output file \"%s\".\n", pFileName);
+    return 1;
+  }
+  RetValue = Lsv_GiaStreamMoCuts(pGia, pPars, NULL, pFile);
+  if (pFileName && fclose(pFile) != 0 && RetValue == 0) {
+    Abc_Print(-1, "Cannot write output file \"%s\".\n", pFileName);
+    RetValue = 1;
+  }
+  return RetValue;
+
+usage:
+  Abc_Print(-2, "usage: &lsv_printmocut [-pM num] [-F file] [-sntvh] <k> <l>\n");
+  Abc_Print(-2, "\t         prints the k-feasible cuts shared by at least l nodes of the current AIG\n");
+  Abc_Print(-2, "\t-p num  : the number of threads enumerating each level [default = %d]\n", pPars->nThreads);
+  Abc_Print(-2, "\t-M num  : the memory for buffering cuts in the streaming mode (MB) [default = %d]\n", pPars->nStreamMem);
+  Abc_Print(-2, "\t-F file : the output file in the streaming mode [default = stdout]\n");
+  Abc_Print(-2, "\t-s      : toggle streaming the cuts through sorted runs [default = %s]\n", pPars->fStream ? "yes" : "no");
+  Abc_Print(-2, "\t-n      : toggle printing CI names instead of object IDs [default = %s]\n", fNames ? "yes" : "no");
+  Abc_Print(-2, "\t-t      : toggle printing the truth tables of the outputs [default = %s]\n", pPars->fTruth ? "yes" : "no");
+  Abc_Print(-2, "\t-v      : toggle printing runtime statistics [default = %s]\n", pPars->fVerbose ? "yes" : "no");
+  Abc_Print(-2, "\t-h      : print the command usage\n");
+  Abc_Print(-2, "\t<k>     : the max number of cut leaves (1 <= k <= %d)\n", LSV_CUT_SIZE_MAX);
+  Abc_Print(-2, "\t<l>     : the min number of nodes sharing a cut\n");
+  return 1;
+}
+
+int Lsv_CommandBench(Abc_Frame_t* pAbc, int argc, char** argv) {
+  Lsv_MoCutPar_t Pars, *pPars = &Pars;
+  std::vector<Lsv_BenchRow_t> vRows, vBase;
+  std::vector<std::string> vFiles;
+  char *pListName = NULL, *pCsvName = NULL, *pBaseName = NULL;
+  char Buffer[1000];
+  FILE* pFile;
+  int c, nRepeats = 1, Tolerance = 30, fVerbose = 0;
+  Lsv_MoCutSetDefaultPars(pPars);
+  Extra_UtilGetoptReset();
+  while ((c = Extra_UtilGetopt(argc, argv, "KLPRTIOBvh")) != EOF) {
+    switch (c) {
+      case 'K':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-K\" should be followed by an integer.\n");
+          goto usage;
+        }
+        pPars->nCutSize = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (pPars->nCutSize < 1 || pPars->nCutSize > LSV_CUT_SIZE_MAX) goto usage;
+        break;
+      case 'L':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-L\" should be followed by an integer.\n");
+          goto usage;
+        }
+        pPars->nOutMin = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (pPars->nOutMin < 1) goto usage;
+        break;
+      case 'P':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+          goto usage;
+        }
+        pPars->nThreads = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (pPars->nThreads < 1) goto usage;
+        break;
+      case 'R':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-R\" should be followed by an integer.\n");
+          goto usage;
+        }
+        nRepeats = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (nRepeats < 1) goto usage;
+        break;
+      case 'T':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-T\" should be followed by an integer.\n");
+          goto usage;
+        }
+        Tolerance = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (Tolerance < 0) goto usage;
+        break;
+      case 'I':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-I\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pListName = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
+      case 'O':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-O\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pCsvName = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
+      case 'B':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-B\" should be followed by a file name.\n");
+          goto usage;
+        }
+        pBaseName = argv[globalUtilOptind];
+        globalUtilOptind++;
+        break;
+      case 'v':
+        fVerbose ^= 1;
+        break;
+      case 'h':
+        goto usage;
+      default:
+        goto usage;
+    }
+  }
+  // collect the benchmarks from the list file and the command line
+  if (pListName) {
+    pFile = fopen(pListName, "r");
+    if (pFile == NULL) {
+      Abc_Print(-1, "Cannot open the benchmark list \"%s\".\n", pListName);
+      return 1;
+    }
+    while (fgets(Buffer, sizeof(Buffer), pFile)) {
+      char* pName = strtok(Buffer, " \t\r\n");
+      if (pName && pName[0] != '#') vFiles.push_back(pName);
+    }
+    fclose(pFile);
+  }
+  for (; globalUtilOptind < argc; globalUtilOptind++) vFiles.push_back(argv[globalUtilOptind]);
+  if (vFiles.empty()) {
+    Abc_Print(-1, "Expecting the benchmark files.\n");
+    goto usage;
+  }
+  if (pBaseName && Lsv_BenchReadCsv(pBaseName, &vBase)) {
+    Abc_Print(-1, "Cannot read the baseline \"%s\".\n", pBaseName);
+    return 1;
+  }
+  for (const std::string& File : vFiles) {
+    size_t nRows = vRows.size();
+    if (Lsv_BenchRun((char*)File.c_str(), pPars, nRepeats, &vRows)) {
+      Abc_Print(-1, "Benchmarking \"%s\" has failed.\n", File.c_str());
+      return 1;
+    }
+    if (fVerbose)
+      for (; nRows < vRows.size(); nRows++)
+        printf("%-16s %-6s : cuts = %9ld  mocuts = %8ld  time = %8.4f sec\n", vRows[nRows].Name.c_str(),
+               vRows[nRows].Mode.c_str(), vRows[nRows].nCuts, vRows[nRows].nMoCuts, vRows[nRows].TimeTotal);
+  }
+  pFile = pCsvName ? fopen(pCsvName, "w") : stdout;
+  if (pFile == NULL) {
+    Abc_Print(-1, "Cannot open output file \"%s\".\n", pCsvName);
+    return 1;
+  }
+  Lsv_BenchWriteCsv(pFile, vRows);
+  if (pCsvName) fclose(pFile);
+  if (pBaseName && Lsv_BenchCompare(vRows, vBase, Tolerance) > 0) {
+    Abc_Print(-1, "The benchmarks have regressed against the baseline \"%s\".\n", pBaseName);
+    return 1;
+  }
+  return 0;
+
+usage:
+  Abc_Print(-2, "usage: lsv_bench [-KLPRT num] [-IOB file] [-vh] <file> ...\n");
+  Abc_Print(-2, "\t         runs the multi-output cut enumeration on the benchmarks and reports a CSV table\n");
+  Abc_Print(-2, "\t-K num  : the max number of cut leaves (1 <= num <= %d) [default = %d]\n", LSV_CUT_SIZE_MAX, pPars->nCutSize);
+  Abc_Print(-2, "\t-L num  : the min number of nodes sharing a cut [default = %d]\n", pPars->nOutMin);
+  Abc_Print(-2, "\t-P num  : the number of threads enumerating each level [default = %d]\n", pPars->nThreads);
+  Abc_Print(-2, "\t-R num  : the number of runs per mode, the fastest is reported [default = %d]\n", nRepeats);
+  Abc_Print(-2, "\t-T num  : the slowdown tolerated against the baseline (%%) [default = %d]\n", Tolerance);
+  Abc_Print(-2, "\t-I file : the file listing the benchmarks, one per line [default = none]\n");
+  Abc_Print(-2, "\t-O file : the output CSV file [default = stdout]\n");
+  Abc_Print(-2, "\t-B file : the baseline CSV file to compare against [default = none]\n");
+  Abc_Print(-2, "\t-v      : toggle printing a summary of each run [default = %s]\n", fVerbose ? "yes" : "no");
+  Abc_Print(-2, "\t-h      : print the command usage\n");
+  return 1;
+}
@@ -0,0 +1,55 @@
+#include "ext-lsv/lsvInt.h"
+
+// returns 1 if the manager is a plain AIG whose AND nodes have two fanins
+int Lsv_GiaCheckAig(Gia_Man_t* p) { return p->pMuxes == NULL && Gia_ManBufNum(p) == 0; }
+
+// derives the AIG in the &-space from the strashed network without
+// rehashing, so that every AND node keeps its own object; the map takes
+// the object IDs of the new manager to the object IDs of the network
+Gia_Man_t* Lsv_NtkToGia(Abc_Ntk_t* pNtk, Vec_Int_t** pvMap) {
+  Gia_Man_t* pNew;
+  Vec_Ptr_t* vNodes;
+  Vec_Int_t* vMap;
+  Abc_Obj_t* pObj;
+  int i;
+  assert(Abc_NtkIsStrash(pNtk));
+  pNew = Gia_ManStart(Abc_NtkObjNumMax(pNtk));
+  pNew->pName = Abc_UtilStrsav(pNtk->pName);
+  vMap = Vec_IntAlloc(Abc_NtkObjNumMax(pNtk));
+  Vec_IntPush(vMap, Abc_ObjId(Abc_AigConst1(pNtk)));
+  Abc_AigConst1(pNtk)->iTemp = 1;
+  Abc_NtkForEachCi(pNtk, pObj, i) {
+    pObj->iTemp = Gia_ManAppendCi(pNew);
+    Vec_IntPush(vMap, Abc_ObjId(pObj));
+  }
+  vNodes = Abc_AigDfs(pNtk, 1, 0);
+  Vec_PtrForEachEntry(Abc_Obj_t*, vNodes, pObj, i) {
+    pObj->iTemp = Gia_ManAppendAnd(pNew, Abc_LitNotCond(Abc_ObjFanin0(pObj)->iTemp, Abc_ObjFaninC0(pObj)),
+                                   Abc_LitNotCond(Abc_ObjFanin1(pObj)->iTemp, Abc_ObjFaninC1(pObj)));
+    Vec_IntPush(vMap, Abc_ObjId(pObj));
+  }
+  Vec_PtrFree(vNodes);
+  Abc_NtkForEachCo(pNtk, pObj, i) {
+    Gia_ManAppendCo(pNew, Abc_LitNotCond(Abc_ObjFanin0(pObj)->iTemp, Abc_ObjFaninC0(pObj)));
+    Vec_IntPush(vMap, Abc_ObjId(pObj));
+  }
+  Gia_ManSetRegNum(pNew, Abc_NtkLatchNum(pNtk));
+  assert(Vec_IntSize(vMap) == Gia_ManObjNum(pNew));
+  *pvMap = vMap;
+  return pNew;
+}
+
+// prints the multi-output cuts of the AIG in the &-space using the CI names
+// if the manager has them
+void Lsv_GiaPrintMoCuts(Gia_Man_t* p, Lsv_MoCutPar_t* pPars, int fNames) {
+  Lsv_MoCuts_t MoCuts;
+  std::vector<char*> vNames;
+  Gia_Obj_t* pObj;
+  int i;
+  Lsv_GiaComputeMoCuts(p, pPars, NULL, &MoCuts);
+  if (fNames && p->vNamesIn) {
+    vNames.resize(Gia_ManObjNum(p));
+    Gia_ManForEachCi(p, pObj, i) vNames[Gia_ObjId(p, pObj)] = Gia_ObjCiName(p, i);
+  }
+  Lsv_MoCutsPrint(stdout, &MoCuts, vNames.empty() ? NULL : vNames.data());
+}
@@ -0,0 +1,149 @@
+#ifndef ABC__ext_lsv__lsvInt_h
+#define ABC__ext_lsv__lsvInt_h
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "aig/gia/gia.h"
+#include "base/abc/abc.h"
+#include "misc/util/utilTruth.h"
+
+// the largest supported cut size
+#define LSV_CUT_SIZE_MAX 6
+
+// statistics of one run of multi-output cut enumeration
+struct Lsv_MoCutStats_t {
+  int nLevels;         // the number of levels
+  long nCuts;          // the number of cuts computed at all objects
+  long nMoCuts;        // the number of multi-output cuts
+  double MemSto;       // the peak memory of the cut store (bytes)
+  abctime clkEnum;     // the time of enumeration
+  abctime clkCollect;  // the time of collecting (or merging) the shared cuts
+};
+
+// parameters of multi-output cut enumeration
+struct Lsv_MoCutPar_t {
+  int nCutSize;    // the max number of leaves in a cut (k)
+  int nOutMin;     // the min number of outputs sharing a cut (l)
+  int nThreads;    // the number of threads used for enumeration
+  int fStream;     // streams the cuts through sorted runs
+  int nStreamMem;  // the memory for buffering cuts in the streaming mode (MB)
+  int fTruth;      // computes the truth tables of the outputs
+  int fVerbose;    // prints runtime statistics
+  Lsv_MoCutStats_t* pStats;  // receives the statistics of the run (or NULL)
+};
+
+// a cut with a fixed-width leaf array
+struct Lsv_Cut_t {
+  word Sign;                      // signature of the leaves
+  int nLeaves;                    // the number of leaves
+  int pLeaves[LSV_CUT_SIZE_MAX];  // leaf IDs sorted ascendingly
+  word Truth;                     // the function of the node in terms of the leaves (with fTruth)
+};
+
+// one row of the benchmark table (times in seconds, memory in MB)
+struct Lsv_BenchRow_t {
+  std::string Name;    // the benchmark file without the path
+  std::string Mode;    // the enumeration mode (ntk, gia or stream)
+  int nCutSize;        // the max number of leaves
+  int nOutMin;         // the min number of outputs sharing a cut
+  int nThreads;        // the number of threads
+  int nAnds;           // the number of AND nodes
+  int nLevels;         // the number of levels
+  long nCuts;          // the number of cuts computed at all objects
+  long nMoCuts;        // the number of multi-output cuts
+  double TimeRead;     // reading the file
+  double TimeDerive;   // strashing (and deriving the &-space AIG)
+  double TimeEnum;     // enumerating the cuts
+  double TimeCollect;  // collecting (or merging) the shared cuts
+  double TimePrint;    // printing the shared cuts
+  double TimeTotal;    // all of the above
+  double MemSto;       // the peak memory of the cut store
+  double MemPeak;      // the peak resident set size of the process
+};
+
+// the store keeping the cuts of all nodes in one arena
+struct Lsv_Sto_t;
+
+// the cuts shared by at least l nodes, sorted by leaves
+struct Lsv_MoCuts_t {
+  std::vector<Lsv_Cut_t> vCuts;  // the shared cuts
+  std::vector<int> vOutBeg;      // the outputs of cut i start at vOuts[vOutBeg[i]]
+  std::vector<int> vOuts;        // the sorted output IDs of each cut
+  std::vector<word> vTruths;     // the function of each output (with fTruth)
+  std::vector<int> vFuncs;       // the multi-output function of each cut (see Lsv_MoCutsClassify)
+  std::vector<int> vClasses;     // the NPN class of each cut (see Lsv_MoCutsClassify)
+};
+
+static inline int Lsv_MoCutsNum(Lsv_MoCuts_t* p) { return (int)p->vCuts.size(); }
+static inline int Lsv_MoCutsOutNum(Lsv_MoCuts_t* p, int i) { return p->vOutBeg[i + 1] - p->vOutBeg[i]; }
+static inline int* Lsv_MoCutsOuts(Lsv_MoCuts_t* p, int i) { return p->vOuts.data() + p->vOutBeg[i]; }
+static inline word* Lsv_MoCutsTruths(Lsv_MoCuts_t* p, int i) { return p->vTruths.data() + p->vOutBeg[i]; }
+
+// translates the leaves of the cut through the ID map and keeps them sorted;
+// the variables of the cut function and of the nTruths functions in pTruths
+// are permuted along with the leaves
+static inline void Lsv_CutRemap(Lsv_Cut_t* pCut, const int* pMap, word* pTruths, int nTruths) {
+  int i, k, t, Temp;
+  for (i = 0; i < pCut->nLeaves; i++) pCut->pLeaves[i] = pMap[pCut->pLeaves[i]];
+  for (i = 1; i < pCut->nLeaves; i++)
+    for (k = i; k > 0 && pCut->pLeaves[k - 1] > pCut->pLeaves[k]; k--) {
+      Temp = pCut->pLeaves[k - 1], pCut->pLeaves[k - 1] = pCut->pLeaves[k], pCut->pLeaves[k] = Temp;
+      pCut->Truth = Abc_Tt6SwapAdjacent(pCut->Truth, k - 1);
+      for (t = 0; t < nTruths; t++) pTruths[t] = Abc_Tt6SwapAdjacent(pTruths[t], k - 1);
+    }
+}
+
+// called for every object as soon as its cuts are in the store
+typedef std::function<void(int iThread, int iObj)> Lsv_VisitFunc_t;
+// enumerates the cuts of one AIG into the store; returns the number of levels
+typedef std::function<int(Lsv_Sto_t* pSto, int fRelease, const Lsv_VisitFunc_t& Visit)> Lsv_EnumFunc_t;
+
+
+// lsvSto.cpp
+extern Lsv_Sto_t* Lsv_StoAlloc(int nObjs, int nCutSize, int nThreads, int fTruth);
+extern void Lsv_StoFree(Lsv_Sto_t* p);
+extern void Lsv_StoAddUnit(Lsv_Sto_t* p, int iThread, int iObj);
+extern void Lsv_StoComputeNode(Lsv_Sto_t* p, int iThread, int iObj, int iFan0, int iFan1, int fCompl0,
+                               int fCompl1);
+extern void Lsv_StoObjRelease(Lsv_Sto_t* p, int iObj);
+extern int Lsv_StoObjCutNum(Lsv_Sto_t* p, int iObj);
+extern Lsv_Cut_t* Lsv_StoObjCuts(Lsv_Sto_t* p, int iObj);
+extern long Lsv_StoCutNum(Lsv_Sto_t* p);
+extern double Lsv_StoMemory(Lsv_Sto_t* p);
+extern int Lsv_CutCompare(const Lsv_Cut_t* pCut0, const Lsv_Cut_t* pCut1);
+extern unsigned Lsv_CutHash(const Lsv_Cut_t* pCut);
+
+// lsvMoCut.cpp
+extern void Lsv_MoCutSetDefaultPars(Lsv_MoCutPar_t* pPars);
+extern int Lsv_NtkEnumerateCuts(Abc_Ntk_t* pNtk, Lsv_MoCutPar_t* pPars, Lsv_Sto_t* pSto, int fRelease,
+                                const Lsv_VisitFunc_t& Visit);
+extern int Lsv_GiaEnumerateCuts(Gia_Man_t* p, Lsv_MoCutPar_t* pPars, Lsv_Sto_t* pSto, int fRelease,
+                                const Lsv_VisitFunc_t& Visit);
+extern void Lsv_NtkComputeMoCuts(Abc_Ntk_t* pNtk, Lsv_MoCutPar_t* pPars, Lsv_MoCuts_t* pMoCuts);
+extern void Lsv_GiaComputeMoCuts(Gia_Man_t* p, Lsv_MoCutPar_t* pPars, Vec_Int_t* vMap, Lsv_MoCuts_t* pMoCuts);
+extern void Lsv_MoCutsPrint(FILE* pFile, Lsv_MoCuts_t* pMoCuts, char** ppNames);
+extern void Lsv_NtkPrintMoCuts(Abc_Ntk_t* pNtk, Lsv_MoCutPar_t* pPars);
+
+// lsvStream.cpp
+extern int Lsv_NtkStreamMoCuts(Abc_Ntk_t* pNtk, Lsv_MoCutPar_t* pPars, FILE* pFile);
+extern int Lsv_GiaStreamMoCuts(Gia_Man_t* p, Lsv_MoCutPar_t* pPars, Vec_Int_t* vMap, FILE* pFile);
+
+// lsvGia.cpp
+extern Gia_Man_t* Lsv_NtkToGia(Abc_Ntk_t* pNtk, Vec_Int_t** pvMap);
+extern int Lsv_GiaCheckAig(Gia_Man_t* p);
+extern void Lsv_GiaPrintMoCuts(Gia_Man_t* p, Lsv_MoCutPar_t* pPars, int fNames);
+
+// lsvNpn.cpp
+extern int Lsv_MoCutsClassify(Lsv_MoCuts_t* pMoCuts, int* pnFuncs);
+extern void Lsv_MoCutsPrintClasses(FILE* pFile, Lsv_MoCuts_t* pMoCuts);
+
+// lsvBench.cpp
+extern int Lsv_BenchRun(char* pFileName, Lsv_MoCutPar_t* pPars, int nRepeats, std::vector<Lsv_BenchRow_t>* pvRows);
+extern void Lsv_BenchWriteCsv(FILE* pFile, const std::vector<Lsv_BenchRow_t>& vRows);
+extern int Lsv_BenchReadCsv(char* pFileName, std::vector<Lsv_BenchRow_t>* pvRows);
+extern int Lsv_BenchCompare(const std::vector<Lsv_BenchRow_t>& vRows, const std::vector<Lsv_BenchRow_t>& vBase,
+                            int Tolerance);
+
+#endif
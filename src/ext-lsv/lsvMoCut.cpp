@@ -0,0 +1,374 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "ext-lsv/lsvInt.h"
+
+// the concurrent table mapping each cut to the nodes sharing it; the table
+// is split into shards guarded by their own locks, each shard is an
+// open-addressed array of cuts pointing into the store, and the nodes of a
+// cut (with their own copies of the cut) are chained in a per-shard owner list
+class Lsv_MoCutTable {
+ public:
+  explicit Lsv_MoCutTable(int nShards) : vShards(nShards) {}
+  void Insert(const Lsv_Cut_t* pCut, int iNode) {
+    unsigned Key = Lsv_CutHash(pCut);
+    Shard& S = vShards[Key % vShards.size()];
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    if (2 * (S.nEntries + 1) > (int)S.vBins.size()) Resize(S);
+    Entry* pEntry = Lookup(S, pCut, Key);
+    if (pEntry->pCut == nullptr) {
+      pEntry->pCut = pCut;
+      S.nEntries++;
+    }
+    S.vOwners.push_back({pCut, iNode, pEntry->iLast});
+    pEntry->iLast = (int)S.vOwners.size() - 1;
+    pEntry->nOuts++;
+  }
+  // collects the cuts shared by at least nOutMin nodes in the sorted order;
+  // the IDs are translated through pMap if it is given; with fTruth, the
+  // functions of the outputs are collected too
+  void Collect(int nOutMin, const int* pMap, int fTruth, Lsv_MoCuts_t* pMoCuts) {
+    std::vector<Lsv_Cut_t> vCuts;
+    std::vector<int> vOutBeg(1, 0), vOuts;
+    std::vector<word> vTruths;
+    std::vector<std::pair<int, word>> vPairs;
+    for (const Shard& S : vShards)
+      for (const Entry& E : S.vBins) {
+        if (E.pCut == nullptr || E.nOuts < nOutMin) continue;
+        for (int iOwner = E.iLast; iOwner != -1; iOwner = S.vOwners[iOwner].iPrev)
+          vOuts.push_back(pMap ? pMap[S.vOwners[iOwner].iNode] : S.vOwners[iOwner].iNode);
+        if (!fTruth)
+          std::sort(vOuts.begin() + vOutBeg.back(), vOuts.end());
+        else {
+          // sort the outputs together with their functions
+          vPairs.clear();
+          for (int iOwner = E.iLast, k = vOutBeg.back(); iOwner != -1; iOwner = S.vOwners[iOwner].iPrev, k++)
+            vPairs.push_back({vOuts[k], S.vOwners[iOwner].pCut->Truth});
+          std::sort(vPairs.begin(), vPairs.end());
+          for (size_t k = 0; k < vPairs.size(); k++) {
+            vOuts[vOutBeg.back() + k] = vPairs[k].first;
+            vTruths.push_back(vPairs[k].second);
+          }
+        }
+        vCuts.push_back(*E.pCut);
+        if (pMap && fTruth)
+          Lsv_CutRemap(&vCuts.back(), pMap, vTruths.data() + vOutBeg.back(), (int)vPairs.size());
+        else if (pMap)
+          Lsv_CutRemap(&vCuts.back(), pMap, NULL, 0);
+        vOutBeg.push_back((int)vOuts.size());
+      }
+    std::vector<int> vOrder(vCuts.size());
+    for (size_t i = 0; i < vOrder.size(); i++) vOrder[i] = (int)i;
+    std::sort(vOrder.begin(), vOrder.end(),
+              [&](int a, int b) { return Lsv_CutCompare(&vCuts[a], &vCuts[b]) < 0; });
+    pMoCuts->vCuts.clear();
+    pMoCuts->vOutBeg.assign(1, 0);
+    pMoCuts->vOuts.clear();
+    pMoCuts->vTruths.clear();
+    pMoCuts->vFuncs.clear();
+    pMoCuts->vClasses.clear();
+    for (int i : vOrder) {
+      pMoCuts->vCuts.push_back(vCuts[i]);
+      pMoCuts->vOuts.insert(pMoCuts->vOuts.end(), vOuts.begin() + vOutBeg[i], vOuts.begin() + vOutBeg[i + 1]);
+      if (fTruth)
+        pMoCuts->vTruths.insert(pMoCuts->vTruths.end(), vTruths.begin() + vOutBeg[i], vTruths.begin() + vOutBeg[i + 1]);
+      pMoCuts->vOutBeg.push_back((int)pMoCuts->vOuts.size());
+    }
+  }
+  size_t Size() const {
+    size_t nCuts = 0;
+    for (const Shard& S : vShards) nCuts += S.nEntries;
+    return nCuts;
+  }
+
+ private:
+  struct Entry {
+    const Lsv_Cut_t* pCut = nullptr;  // the cut in the store
+    int iLast = -1;                   // the last owner in the owner list
+    int nOuts = 0;                    // the number of owners
+  };
+  struct Owner {
+    const Lsv_Cut_t* pCut;  // the cut of the node in the store
+    int iNode;              // the node ID
+    int iPrev;              // the previous owner of the same cut
+  };
+  struct Shard {
+    std::mutex Mutex;
+    std::vector<Entry> vBins;    // the open-addressed bins
+    std::vector<Owner> vOwners;  // the owners of all cuts
+    int nEntries = 0;
+  };
+  static Entry* Lookup(Shard& S, const Lsv_Cut_t* pCut, unsigned Key) {
+    size_t Mask = S.vBins.size() - 1, i = (Key >> 8) & Mask;
+    while (S.vBins[i].pCut && Lsv_CutCompare(S.vBins[i].pCut, pCut) != 0) i = (i + 1) & Mask;
+    return &S.vBins[i];
+  }
+  static void Resize(Shard& S) {
+    std::vector<Entry> vOld(std::max<size_t>(64, 2 * S.vBins.size()));
+    vOld.swap(S.vBins);
+    for (const Entry& E : vOld)
+      if (E.pCut) *Lookup(S, E.pCut, Lsv_CutHash(E.pCut)) = E;
+  }
+  std::vector<Shard> vShards;
+};
+
+// a pool of threads executing the same job; the calling thread is worker 0
+class Lsv_ThreadPool {
+ public:
+  explicit Lsv_ThreadPool(int nThreads) {
+    for (int i = 1; i < nThreads; i++)
+      vThreads.emplace_back(&Lsv_ThreadPool::Worker, this, i);
+  }
+  ~Lsv_ThreadPool() {
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      fStop = true;
+    }
+    CondStart.notify_all();
+    for (std::thread& Thread : vThreads) Thread.join();
+  }
+  int Size() const { return (int)vThreads.size() + 1; }
+  // runs Job(iThread) on all threads and returns when every thread is done
+  void Run(const std::function<void(int)>& Job) {
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      pJob = &Job;
+      nBusy = (int)vThreads.size();
+      nEpoch++;
+    }
+    CondStart.notify_all();
+    Job(0);
+    std::unique_lock<std::mutex> Lock(Mutex);
+    CondDone.wait(Lock, [this] { return nBusy == 0; });
+    pJob = nullptr;
+  }
+
+ private:
+  void Worker(int iThread) {
+    int nEpochSeen = 0;
+    while (1) {
+      const std::function<void(int)>* pJobCur;
+      {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        CondStart.wait(Lock, [&] { return fStop || nEpoch != nEpochSeen; });
+        if (fStop) return;
+        nEpochSeen = nEpoch;
+        pJobCur = pJob;
+      }
+      (*pJobCur)(iThread);
+      {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (--nBusy == 0) CondDone.notify_one();
+      }
+    }
+  }
+  std::vector<std::thread> vThreads;
+  std::mutex Mutex;
+  std::condition_variable CondStart;
+  std::condition_variable CondDone;
+  const std::function<void(int)>* pJob = nullptr;
+  int nEpoch = 0;
+  int nBusy = 0;
+  bool fStop = false;
+};
+
+void Lsv_MoCutSetDefaultPars(Lsv_MoCutPar_t* pPars) {
+  pPars->nCutSize = 3;
+  pPars->nOutMin = 2;
+  pPars->nThreads = 1;
+  pPars->fStream = 0;
+  pPars->nStreamMem = 64;
+  pPars->fTruth = 0;
+  pPars->fVerbose = 0;
+  pPars->pStats = NULL;
+}
+
+// the strashed network seen by the enumeration
+struct Lsv_NtkView_t {
+  Abc_Ntk_t* pNtk;
+  int ObjNum() const { return Abc_NtkObjNumMax(pNtk); }
+  int Fanin0(int iObj) const { return Abc_ObjFaninId0(Abc_NtkObj(pNtk, iObj)); }
+  int Fanin1(int iObj) const { return Abc_ObjFaninId1(Abc_NtkObj(pNtk, iObj)); }
+  int Compl0(int iObj) const { return Abc_ObjFaninC0(Abc_NtkObj(pNtk, iObj)); }
+  int Compl1(int iObj) const { return Abc_ObjFaninC1(Abc_NtkObj(pNtk, iObj)); }
+  // collects the CIs and the AND nodes grouped by level; returns the number of levels
+  int Collect(std::vector<int>& vCis, std::vector<std::vector<int>>& vLevels) const {
+    Abc_Obj_t* pObj;
+    int i, nLevels = Abc_NtkLevel(pNtk);
+    vLevels.resize(nLevels + 1);
+    Abc_NtkForEachCi(pNtk, pObj, i) vCis.push_back(Abc_ObjId(pObj));
+    Abc_AigForEachAnd(pNtk, pObj, i) vLevels[Abc_ObjLevel(pObj)].push_back(Abc_ObjId(pObj));
+    return nLevels;
+  }
+};
+
+// the AIG in the &-space seen by the enumeration
+struct Lsv_GiaView_t {
+  Gia_Man_t* p;
+  int ObjNum() const { return Gia_ManObjNum(p); }
+  int Fanin0(int iObj) const { return Gia_ObjFaninId0(Gia_ManObj(p, iObj), iObj); }
+  int Fanin1(int iObj) const { return Gia_ObjFaninId1(Gia_ManObj(p, iObj), iObj); }
+  int Compl0(int iObj) const { return Gia_ObjFaninC0(Gia_ManObj(p, iObj)); }
+  int Compl1(int iObj) const { return Gia_ObjFaninC1(Gia_ManObj(p, iObj)); }
+  int Collect(std::vector<int>& vCis, std::vector<std::vector<int>>& vLevels) const {
+    Gia_Obj_t* pObj;
+    int i, nLevels = Gia_ManLevelNum(p);
+    vLevels.resize(nLevels + 1);
+    Gia_ManForEachCi(p, pObj, i) vCis.push_back(Gia_ObjId(p, pObj));
+    Gia_ManForEachAnd(p, pObj, i) vLevels[Gia_ObjLevelId(p, i)].push_back(i);
+    return nLevels;
+  }
+};
+
+// enumerates the cuts level by level and calls Visit(iThread, iObj) as soon
+// as the cuts of a CI or an AND node are in the store; with fRelease, the
+// cuts of a node are released once all its fanouts are visited;
+// returns the number of levels
+template <class View>
+static int Lsv_EnumerateCuts(const View& V, Lsv_MoCutPar_t* pPars, Lsv_Sto_t* pSto, int fRelease,
+                             const Lsv_VisitFunc_t& Visit) {
+  // group the AND nodes by level; the nodes of one level are independent
+  std::vector<int> vCis;
+  std::vector<std::vector<int>> vLevels;
+  int nLevels = V.Collect(vCis, vLevels);
+  std::vector<int> vRefs(fRelease ? V.ObjNum() : 0);
+  if (fRelease)
+    for (const std::vector<int>& vNodes : vLevels)
+      for (int iObj : vNodes) vRefs[V.Fanin0(iObj)]++, vRefs[V.Fanin1(iObj)]++;
+  for (int iObj : vCis) {
+    Lsv_StoAddUnit(pSto, 0, iObj);
+    Visit(0, iObj);
+    if (fRelease && vRefs[iObj] == 0) Lsv_StoObjRelease(pSto, iObj);
+  }
+  Lsv_ThreadPool Pool(std::max(1, pPars->nThreads));
+  for (const std::vector<int>& vNodes : vLevels) {
+    if (vNodes.empty()) continue;
+    std::atomic<size_t> iNext(0);
+    auto Job = [&](int iThread) {
+      const size_t nChunk = 16;
+      size_t iStart;
+      while ((iStart = iNext.fetch_add(nChunk)) < vNodes.size()) {
+        size_t iStop = std::min(iStart + nChunk, vNodes.size());
+        for (size_t k = iStart; k < iStop; k++) {
+          int iObj = vNodes[k];
+          Lsv_StoComputeNode(pSto, iThread, iObj, V.Fanin0(iObj), V.Fanin1(iObj), V.Compl0(iObj), V.Compl1(iObj));
+          Visit(iThread, iObj);
+        }
+      }
+    };
+    if (Pool.Size() == 1 || vNodes.size() < 64)
+      Job(0);
+    else
+      Pool.Run(Job);
+    if (!fRelease) continue;
+    for (int iObj : vNodes) {
+      if (--vRefs[V.Fanin0(iObj)] == 0) Lsv_StoObjRelease(pSto, V.Fanin0(iObj));
+      if (--vRefs[V.Fanin1(iObj)] == 0) Lsv_StoObjRelease(pSto, V.Fanin1(iObj));
+      if (vRefs[iObj] == 0) Lsv_StoObjRelease(pSto, iObj);
+    }
+  }
+  return nLevels;
+}
+
+int Lsv_NtkEnumerateCuts(Abc_Ntk_t* pNtk, Lsv_MoCutPar_t* pPars, Lsv_Sto_t* pSto, int fRelease,
+                         const Lsv_VisitFunc_t& Visit) {
+  assert(Abc_NtkIsStrash(pNtk));
+  Lsv_NtkView_t View = {pNtk};
+  return Lsv_EnumerateCuts(View, pPars, pSto, fRelease, Visit);
+}
+
+int Lsv_GiaEnumerateCuts(Gia_Man_t* p, Lsv_MoCutPar_t* pPars, Lsv_Sto_t* pSto, int fRelease,
+                         const Lsv_VisitFunc_t& Visit) {
+  assert(p->pMuxes == NULL && Gia_ManBufNum(p) == 0);
+  Lsv_GiaView_t View = {p};
+  return Lsv_EnumerateCuts(View, pPars, pSto, fRelease, Visit);
+}
+
+// computes the multi-output cuts of the AIG whose cuts are enumerated by
+// Enumerate; the IDs are translated through pMap if it is given
+static void Lsv_ComputeMoCuts(int nObjs, const Lsv_EnumFunc_t& Enumerate, Lsv_MoCutPar_t* pPars,
+                              const int* pMap, Lsv_MoCuts_t* pMoCuts) {
+  abctime clk = Abc_Clock();
+  int nThreads = std::max(1, pPars->nThreads);
+  Lsv_Sto_t* pSto = Lsv_StoAlloc(nObjs, pPars->nCutSize, nThreads, pPars->fTruth);
+  Lsv_MoCutTable Table(nThreads == 1 ? 1 : 64 * nThreads);
+  int nLevels = Enumerate(pSto, 0, [&](int iThread, int iObj) {
+    Lsv_Cut_t* pCuts = Lsv_StoObjCuts(pSto, iObj);
+    for (int c = 0; c < Lsv_StoObjCutNum(pSto, iObj); c++) Table.Insert(pCuts + c, iObj);
+  });
+  abctime clkEnum = Abc_Clock() - clk;
+  clk = Abc_Clock();
+  Table.Collect(pPars->nOutMin, pMap, pPars->fTruth, pMoCuts);
+  if (pPars->pStats) {
+    pPars->pStats->nLevels = nLevels;
+    pPars->pStats->nCuts = Lsv_StoCutNum(pSto);
+    pPars->pStats->nMoCuts = Lsv_MoCutsNum(pMoCuts);
+    pPars->pStats->MemSto = Lsv_StoMemory(pSto);
+    pPars->pStats->clkEnum = clkEnum;
+    pPars->pStats->clkCollect = Abc_Clock() - clk;
+  }
+  if (pPars->fVerbose) {
+    printf("Levels = %d. Threads = %d. Distinct cuts = %lu. Multi-output cuts = %d. Store = %.2f MB.\n",
+           nLevels, nThreads, (unsigned long)Table.Size(), Lsv_MoCutsNum(pMoCuts),
+           Lsv_StoMemory(pSto) / (1 << 20));
+    Abc_PrintTime(1, "Enumeration", clkEnum);
+    Abc_PrintTime(1, "Collection ", Abc_Clock() - clk);
+  }
+  Lsv_StoFree(pSto);
+}
+
+void Lsv_NtkComputeMoCuts(Abc_Ntk_t* pNtk, Lsv_MoCutPar_t* pPars, Lsv_MoCuts_t* pMoCuts) {
+  Lsv_EnumFunc_t Enumerate = [&](Lsv_Sto_t* pSto, int fRelease, const Lsv_VisitFunc_t& Visit) {
+    return Lsv_NtkEnumerateCuts(pNtk, pPars, pSto, fRelease, Visit);
+  };
+  Lsv_ComputeMoCuts(Abc_NtkObjNumMax(pNtk), Enumerate, pPars, NULL, pMoCuts);
+}
+
+void Lsv_GiaComputeMoCuts(Gia_Man_t* p, Lsv_MoCutPar_t* pPars, Vec_Int_t* vMap, Lsv_MoCuts_t* pMoCuts) {
+  Lsv_EnumFunc_t Enumerate = [&](Lsv_Sto_t* pSto, int fRelease, const Lsv_VisitFunc_t& Visit) {
+    return Lsv_GiaEnumerateCuts(p, pPars, pSto, fRelease, Visit);
+  };
+  Lsv_ComputeMoCuts(Gia_ManObjNum(p), Enumerate, pPars, vMap ? Vec_IntArray(vMap) : NULL, pMoCuts);
+}
+
+// prints the multi-output cuts; the objects with names are printed by name
+// and the functions of the outputs are appended if they were computed
+void Lsv_MoCutsPrint(FILE* pFile, Lsv_MoCuts_t* pMoCuts, char** ppNames) {
+  int i, k, Id;
+  for (i = 0; i < Lsv_MoCutsNum(pMoCuts); i++) {
+    Lsv_Cut_t* pCut = &pMoCuts->vCuts[i];
+    for (k = 0; k < pCut->nLeaves; k++) {
+      Id = pCut->pLeaves[k];
+      if (ppNames && ppNames[Id])
+        fprintf(pFile, "%s ", ppNames[Id]);
+      else
+        fprintf(pFile, "%d ", Id);
+    }
+    fprintf(pFile, ":");
+    for (k = 0; k < Lsv_MoCutsOutNum(pMoCuts, i); k++) {
+      Id = Lsv_MoCutsOuts(pMoCuts, i)[k];
+      if (ppNames && ppNames[Id])
+        fprintf(pFile, " %s", ppNames[Id]);
+      else
+        fprintf(pFile, " %d", Id);
+    }
+    if (!pMoCuts->vTruths.empty()) {
+      fprintf(pFile, " :");
+      for (k = 0; k < Lsv_MoCutsOutNum(pMoCuts, i); k++) {
+        fprintf(pFile, " ");
+        Abc_TtPrintHexRev(pFile, Lsv_MoCutsTruths(pMoCuts, i) + k, pCut->nLeaves);
+      }
+    }
+    fprintf(pFile, "\n");
+  }
+}
+
+void Lsv_NtkPrintMoCuts(Abc_Ntk_t* pNtk, Lsv_MoCutPar_t* pPars) {
+  Lsv_MoCuts_t MoCuts;
+  Lsv_NtkComputeMoCuts(pNtk, pPars, &MoCuts);
+  Lsv_MoCutsPrint(stdout, &MoCuts, NULL);
+}
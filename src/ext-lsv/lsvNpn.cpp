@@ -0,0 +1,92 @@
+#include <algorithm>
+
+#include "ext-lsv/lsvInt.h"
+#include "misc/vec/vecHsh.h"
+#include "misc/vec/vecMem.h"
+#include "opt/dau/dau.h"
+
+// groups the multi-output cuts by their functions in one pass: the output
+// functions are interned in a Vec_Mem_t and every distinct function is
+// canonicalized by Abc_TtCanonicize() only once; two cuts get the same
+// vFuncs entry if they have the same number of leaves and the same set of
+// output functions, and the same vClasses entry if the output functions
+// fall into the same NPN classes; returns the number of NPN classes
+int Lsv_MoCutsClassify(Lsv_MoCuts_t* p, int* pnFuncs) {
+  Vec_Mem_t* vTtMem = Vec_MemAllocForTTSimple(6);
+  Vec_Mem_t* vNpnMem = Vec_MemAllocForTTSimple(6);
+  Vec_Int_t* vTtNpn = Vec_IntAlloc(1000);  // the NPN class of each function and leaf count
+  Hsh_VecMan_t* pFuncHash = Hsh_VecManStart(1000);
+  Hsh_VecMan_t* pClassHash = Hsh_VecManStart(1000);
+  Vec_Int_t* vFunc = Vec_IntAlloc(16);
+  Vec_Int_t* vClass = Vec_IntAlloc(16);
+  char pCanonPerm[16];
+  int i, k, nLeaves, iFunc, iNpn, nClasses;
+  assert(p->vTruths.size() == p->vOuts.size());
+  p->vFuncs.resize(Lsv_MoCutsNum(p));
+  p->vClasses.resize(Lsv_MoCutsNum(p));
+  for (i = 0; i < Lsv_MoCutsNum(p); i++) {
+    nLeaves = p->vCuts[i].nLeaves;
+    Vec_IntClear(vFunc);
+    Vec_IntClear(vClass);
+    for (k = 0; k < Lsv_MoCutsOutNum(p, i); k++) {
+      word Truth = Lsv_MoCutsTruths(p, i)[k];
+      iFunc = Vec_MemHashInsert(vTtMem, &Truth);
+      // the canonical form depends on the number of variables
+      Vec_IntFillExtra(vTtNpn, (iFunc + 1) * (LSV_CUT_SIZE_MAX + 1), -1);
+      iNpn = Vec_IntEntry(vTtNpn, iFunc * (LSV_CUT_SIZE_MAX + 1) + nLeaves);
+      if (iNpn == -1) {
+        Abc_TtCanonicize(&Truth, nLeaves, pCanonPerm);
+        iNpn = Vec_MemHashInsert(vNpnMem, &Truth);
+        Vec_IntWriteEntry(vTtNpn, iFunc * (LSV_CUT_SIZE_MAX + 1) + nLeaves, iNpn);
+      }
+      Vec_IntPush(vFunc, iFunc);
+      Vec_IntPush(vClass, iNpn);
+    }
+    Vec_IntSort(vFunc, 0);
+    Vec_IntSort(vClass, 0);
+    Vec_IntPush(vFunc, nLeaves);
+    Vec_IntPush(vClass, nLeaves);
+    p->vFuncs[i] = Hsh_VecManAdd(pFuncHash, vFunc);
+    p->vClasses[i] = Hsh_VecManAdd(pClassHash, vClass);
+  }
+  if (pnFuncs) *pnFuncs = Hsh_VecSize(pFuncHash);
+  nClasses = Hsh_VecSize(pClassHash);
+  Vec_MemHashFree(vTtMem);
+  Vec_MemFree(vTtMem);
+  Vec_MemHashFree(vNpnMem);
+  Vec_MemFree(vNpnMem);
+  Vec_IntFree(vTtNpn);
+  Hsh_VecManStop(pFuncHash);
+  Hsh_VecManStop(pClassHash);
+  Vec_IntFree(vFunc);
+  Vec_IntFree(vClass);
+  return nClasses;
+}
+
+// prints the NPN classes of the multi-output cuts, the largest classes first
+void Lsv_MoCutsPrintClasses(FILE* pFile, Lsv_MoCuts_t* p) {
+  std::vector<int> vCount, vFirst, vOrder;
+  int i, k, nFuncs, nClasses = Lsv_MoCutsClassify(p, &nFuncs);
+  vCount.resize(nClasses, 0);
+  vFirst.resize(nClasses, -1);
+  for (i = 0; i < Lsv_MoCutsNum(p); i++) {
+    if (vCount[p->vClasses[i]]++ == 0) vFirst[p->vClasses[i]] = i;
+  }
+  for (i = 0; i < nClasses; i++) vOrder.push_back(i);
+  std::stable_sort(vOrder.begin(), vOrder.end(), [&](int a, int b) { return vCount[a] > vCount[b]; });
+  fprintf(pFile, "Multi-output cuts = %d. Functions = %d. NPN classes = %d.\n", Lsv_MoCutsNum(p), nFuncs, nClasses);
+  fprintf(pFile, "%6s %6s %7s %7s  %s\n", "Class", "Leaves", "Outputs", "Cuts", "Example");
+  for (int iClass : vOrder) {
+    Lsv_Cut_t* pCut = &p->vCuts[vFirst[iClass]];
+    fprintf(pFile, "%6d %6d %7d %7d  ", iClass, pCut->nLeaves, Lsv_MoCutsOutNum(p, vFirst[iClass]), vCount[iClass]);
+    for (k = 0; k < pCut->nLeaves; k++) fprintf(pFile, "%d ", pCut->pLeaves[k]);
+    fprintf(pFile, ":");
+    for (k = 0; k < Lsv_MoCutsOutNum(p, vFirst[iClass]); k++) fprintf(pFile, " %d", Lsv_MoCutsOuts(p, vFirst[iClass])[k]);
+    fprintf(pFile, " :");
+    for (k = 0; k < Lsv_MoCutsOutNum(p, vFirst[iClass]); k++) {
+      fprintf(pFile, " ");
+      Abc_TtPrintHexRev(pFile, Lsv_MoCutsTruths(p, vFirst[iClass]) + k, pCut->nLeaves);
+    }
+    fprintf(pFile, "\n");
+  }
+}
@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <mutex>
+
+#include "ext-lsv/lsvInt.h"
+#include "misc/util/utilTruth.h"
+
+// the number of cuts in one page of the arena
+#define LSV_STO_PAGE_SIZE (1 << 14)
+
+// a page of the arena
+struct Lsv_StoPage_t {
+  Lsv_Cut_t* pCuts;  // the cuts
+  int nSize;         // the capacity
+  int nUsed;         // the number of cuts handed out
+  int nLive;         // the number of cuts not released yet
+  int fSealed;       // the page is no longer filled by a thread
+};
+
+// the state of one thread filling the store
+struct Lsv_StoThr_t {
+  Lsv_StoPage_t* pPage = nullptr;  // the page currently filled
+  std::vector<Lsv_Cut_t> vTemp;    // the merged cuts of the current node
+  long nCuts = 0;                  // the number of cuts stored by the thread
+};
+
+struct Lsv_Sto_t {
+  int nCutSize;                          // the max number of leaves
+  int fTruth;                            // computes the functions of the cuts
+  std::vector<Lsv_Cut_t*> vObjCuts;      // the cuts of each object
+  std::vector<int> vObjCutNum;           // the number of cuts of each object
+  std::vector<Lsv_StoPage_t*> vObjPage;  // the page holding the cuts of each object
+  std::vector<Lsv_StoPage_t*> vPages;    // the pages of the arena
+  std::vector<Lsv_StoPage_t*> vFree;     // the recycled pages
+  size_t nCutsAlloc = 0;                 // the number of cuts in all pages
+  size_t nCutsPeak = 0;                  // the max number of cuts in all pages
+  std::mutex PageMutex;                  // guards the lists of pages
+  std::vector<Lsv_StoThr_t> vThrs;       // the per-thread states
+};
+
+Lsv_Sto_t* Lsv_StoAlloc(int nObjs, int nCutSize, int nThreads, int fTruth) {
+  assert(nCutSize >= 1 && nCutSize <= LSV_CUT_SIZE_MAX);
+  Lsv_Sto_t* p = new Lsv_Sto_t;
+  p->nCutSize = nCutSize;
+  p->fTruth = fTruth;
+  p->vObjCuts.resize(nObjs, nullptr);
+  p->vObjCutNum.resize(nObjs, 0);
+  p->vObjPage.resize(nObjs, nullptr);
+  p->vThrs.resize(nThreads);
+  return p;
+}
+
+void Lsv_StoFree(Lsv_Sto_t* p) {
+  for (Lsv_StoPage_t* pPage : p->vPages) {
+    ABC_FREE(pPage->pCuts);
+    delete pPage;
+  }
+  delete p;
+}
+
+int Lsv_StoObjCutNum(Lsv_Sto_t* p, int iObj) { return p->vObjCutNum[iObj]; }
+Lsv_Cut_t* Lsv_StoObjCuts(Lsv_Sto_t* p, int iObj) { return p->vObjCuts[iObj]; }
+
+long Lsv_StoCutNum(Lsv_Sto_t* p) {
+  long nCuts = 0;
+  for (const Lsv_StoThr_t& Thr : p->vThrs) nCuts += Thr.nCuts;
+  return nCuts;
+}
+
+// returns the peak memory of the store in bytes
+double Lsv_StoMemory(Lsv_Sto_t* p) {
+  return (double)p->nCutsPeak * sizeof(Lsv_Cut_t) +
+         (double)p->vObjCuts.size() * (2 * sizeof(void*) + sizeof(int));
+}
+
+// returns an empty page with room for at least nCuts cuts; must be called
+// under the page lock
+static Lsv_StoPage_t* Lsv_StoPageStart(Lsv_Sto_t* p, int nCuts) {
+  Lsv_StoPage_t* pPage;
+  if (nCuts <= LSV_STO_PAGE_SIZE && !p->vFree.empty()) {
+    pPage = p->vFree.back();
+    p->vFree.pop_back();
+  } else {
+    pPage = new Lsv_StoPage_t;
+    pPage->nSize = Abc_MaxInt(nCuts, LSV_STO_PAGE_SIZE);
+    pPage->pCuts = ABC_ALLOC(Lsv_Cut_t, pPage->nSize);
+    p->vPages.push_back(pPage);
+    p->nCutsAlloc += pPage->nSize;
+    p->nCutsPeak = std::max(p->nCutsPeak, p->nCutsAlloc);
+  }
+  pPage->nUsed = pPage->nLive = pPage->fSealed = 0;
+  return pPage;
+}
+
+// returns a sealed page whose cuts are all released to the free list;
+// must be called under the page lock
+static void Lsv_StoPageRecycle(Lsv_Sto_t* p, Lsv_StoPage_t* pPage) {
+  assert(pPage->fSealed && pPage->nLive == 0);
+  if (pPage->nSize == LSV_STO_PAGE_SIZE) {
+    p->vFree.push_back(pPage);
+    return;
+  }
+  // a dedicated page of a large node is returned to the system
+  p->nCutsAlloc -= pPage->nSize;
+  ABC_FREE(pPage->pCuts);
+  pPage->nSize = 0;
+}
+
+// reserves room for nCuts cuts of iObj in the current page of the thread;
+// a node with more cuts than a page gets a dedicated page
+static Lsv_Cut_t* Lsv_StoAllocCuts(Lsv_Sto_t* p, int iThread, int iObj, int nCuts) {
+  Lsv_StoThr_t* pThr = &p->vThrs[iThread];
+  Lsv_StoPage_t* pPage = pThr->pPage;
+  if (pPage == nullptr || pPage->nUsed + nCuts > pPage->nSize) {
+    std::lock_guard<std::mutex> Lock(p->PageMutex);
+    pPage = Lsv_StoPageStart(p, nCuts);
+    if (nCuts > LSV_STO_PAGE_SIZE)
+      pPage->fSealed = 1;
+    else {
+      if (pThr->pPage) {
+        pThr->pPage->fSealed = 1;
+        if (pThr->pPage->nLive == 0) Lsv_StoPageRecycle(p, pThr->pPage);
+      }
+      pThr->pPage = pPage;
+    }
+  }
+  pPage->nUsed += nCuts;
+  pPage->nLive += nCuts;
+  pThr->nCuts += nCuts;
+  p->vObjPage[iObj] = pPage;
+  p->vObjCutNum[iObj] = nCuts;
+  return p->vObjCuts[iObj] = pPage->pCuts + pPage->nUsed - nCuts;
+}
+
+// releases the cuts of an object that is no longer needed; this is not
+// thread-safe and should be called between the parallel phases
+void Lsv_StoObjRelease(Lsv_Sto_t* p, int iObj) {
+  Lsv_StoPage_t* pPage = p->vObjPage[iObj];
+  assert(pPage != nullptr);
+  pPage->nLive -= p->vObjCutNum[iObj];
+  assert(pPage->nLive >= 0);
+  if (pPage->nLive == 0 && pPage->fSealed) Lsv_StoPageRecycle(p, pPage);
+  p->vObjCuts[iObj] = nullptr;
+  p->vObjCutNum[iObj] = 0;
+  p->vObjPage[iObj] = nullptr;
+}
+
+static inline word Lsv_CutGetSign(Lsv_Cut_t* pCut) {
+  word Sign = 0;
+  int i;
+  for (i = 0; i < pCut->nLeaves; i++) Sign |= ((word)1) << (pCut->pLeaves[i] & 0x3F);
+  return Sign;
+}
+static inline int Lsv_CutCountBits(word i) {
+  i = i - ((i >> 1) & 0x5555555555555555);
+  i = (i & 0x3333333333333333) + ((i >> 2) & 0x3333333333333333);
+  i = ((i + (i >> 4)) & 0x0F0F0F0F0F0F0F0F);
+  return (i * (0x0101010101010101)) >> 56;
+}
+
+// merges two sorted leaf arrays; fails if the result has more than nCutSize leaves
+static inline int Lsv_CutMergeOrder(Lsv_Cut_t* pCut0, Lsv_Cut_t* pCut1, Lsv_Cut_t* pCut,
+                                    int nCutSize) {
+  int nSize0 = pCut0->nLeaves, *pC0 = pCut0->pLeaves;
+  int nSize1 = pCut1->nLeaves, *pC1 = pCut1->pLeaves;
+  int i = 0, k = 0, c = 0, *pC = pCut->pLeaves;
+  while (i < nSize0 && k < nSize1) {
+    if (c == nCutSize) return 0;
+    if (pC0[i] < pC1[k])
+      pC[c++] = pC0[i++];
+    else if (pC0[i] > pC1[k])
+      pC[c++] = pC1[k++];
+    else
+      pC[c++] = pC0[i++], k++;
+  }
+  if (c + (nSize0 - i) + (nSize1 - k) > nCutSize) return 0;
+  while (i < nSize0) pC[c++] = pC0[i++];
+  while (k < nSize1) pC[c++] = pC1[k++];
+  pCut->nLeaves = c;
+  pCut->Sign = pCut0->Sign | pCut1->Sign;
+  return 1;
+}
+
+// checks if pCut is contained in pBase
+static inline int Lsv_CutIsContained(Lsv_Cut_t* pBase, Lsv_Cut_t* pCut) {
+  int nSizeB = pBase->nLeaves, nSizeC = pCut->nLeaves, i, k;
+  if (nSizeC > nSizeB || (pCut->Sign & pBase->Sign) != pCut->Sign) return 0;
+  for (i = k = 0; i < nSizeB && k < nSizeC; i++) {
+    if (pBase->pLeaves[i] > pCut->pLeaves[k]) return 0;
+    if (pBase->pLeaves[i] == pCut->pLeaves[k]) k++;
+  }
+  return k == nSizeC;
+}
+
+// checks if the last cut is dominated by (or equal to) one of the previous cuts
+static inline int Lsv_CutSetLastCutIsContained(Lsv_Cut_t* pCuts, int nCuts) {
+  int i;
+  for (i = 0; i < nCuts; i++)
+    if (Lsv_CutIsContained(pCuts + nCuts, pCuts + i)) return 1;
+  return 0;
+}
+
+// removes the previous cuts dominated by the last cut; returns the new number of cuts
+static inline int Lsv_CutSetLastCutContains(Lsv_Cut_t* pCuts, int nCuts) {
+  int i, k;
+  for (i = k = 0; i < nCuts; i++) {
+    if (Lsv_CutIsContained(pCuts + i, pCuts + nCuts)) continue;
+    if (k < i) pCuts[k] = pCuts[i];
+    k++;
+  }
+  if (k < nCuts) pCuts[k] = pCuts[nCuts];
+  return k + 1;
+}
+
+// computes the function of the merged cut from the functions of the fanin
+// cuts, similar to Gia_CutComputeTruth6()
+static inline void Lsv_CutComputeTruth6(Lsv_Cut_t* pCut0, Lsv_Cut_t* pCut1, int fCompl0, int fCompl1,
+                                        Lsv_Cut_t* pCutR) {
+  word t0 = fCompl0 ? ~pCut0->Truth : pCut0->Truth;
+  word t1 = fCompl1 ? ~pCut1->Truth : pCut1->Truth;
+  t0 = Abc_Tt6Expand(t0, pCut0->pLeaves, pCut0->nLeaves, pCutR->pLeaves, pCutR->nLeaves);
+  t1 = Abc_Tt6Expand(t1, pCut1->pLeaves, pCut1->nLeaves, pCutR->pLeaves, pCutR->nLeaves);
+  pCutR->Truth = t0 & t1;
+}
+
+static inline void Lsv_CutSetUnit(Lsv_Cut_t* pCut, int iObj) {
+  pCut->nLeaves = 1;
+  pCut->pLeaves[0] = iObj;
+  pCut->Sign = Lsv_CutGetSign(pCut);
+  pCut->Truth = s_Truths6[0];
+}
+
+void Lsv_StoAddUnit(Lsv_Sto_t* p, int iThread, int iObj) {
+  Lsv_CutSetUnit(Lsv_StoAllocCuts(p, iThread, iObj, 1), iObj);
+}
+
+// computes the irredundant cuts of an AND node from the cuts of its fanins;
+// the fanin cuts are only read, so nodes of the same level can be processed
+// concurrently by different threads
+void Lsv_StoComputeNode(Lsv_Sto_t* p, int iThread, int iObj, int iFan0, int iFan1, int fCompl0, int fCompl1) {
+  Lsv_StoThr_t* pThr = &p->vThrs[iThread];
+  Lsv_Cut_t* pCuts0 = p->vObjCuts[iFan0];
+  Lsv_Cut_t* pCuts1 = p->vObjCuts[iFan1];
+  int nCuts0 = p->vObjCutNum[iFan0], nCuts1 = p->vObjCutNum[iFan1];
+  int i, k, nCuts = 0;
+  if (pThr->vTemp.size() < (size_t)nCuts0 * nCuts1 + 1)
+    pThr->vTemp.resize((size_t)nCuts0 * nCuts1 + 1);
+  Lsv_Cut_t* pTemp = pThr->vTemp.data();
+  for (i = 0; i < nCuts0; i++)
+    for (k = 0; k < nCuts1; k++) {
+      if (Lsv_CutCountBits(pCuts0[i].Sign | pCuts1[k].Sign) > p->nCutSize) continue;
+      if (!Lsv_CutMergeOrder(pCuts0 + i, pCuts1 + k, pTemp + nCuts, p->nCutSize)) continue;
+      if (Lsv_CutSetLastCutIsContained(pTemp, nCuts)) continue;
+      if (p->fTruth) Lsv_CutComputeTruth6(pCuts0 + i, pCuts1 + k, fCompl0, fCompl1, pTemp + nCuts);
+      nCuts = Lsv_CutSetLastCutContains(pTemp, nCuts);
+    }
+  Lsv_CutSetUnit(pTemp + nCuts++, iObj);
+  memcpy(Lsv_StoAllocCuts(p, iThread, iObj, nCuts), pTemp, sizeof(Lsv_Cut_t) * nCuts);
+}
+
+// compares the leaves lexicographically
+int Lsv_CutCompare(const Lsv_Cut_t* pCut0, const Lsv_Cut_t* pCut1) {
+  int i, nSize = Abc_MinInt(pCut0->nLeaves, pCut1->nLeaves);
+  for (i = 0; i < nSize; i++)
+    if (pCut0->pLeaves[i] != pCut1->pLeaves[i])
+      return pCut0->pLeaves[i] < pCut1->pLeaves[i] ? -1 : 1;
+  return pCut0->nLeaves - pCut1->nLeaves;
+}
+
+unsigned Lsv_CutHash(const Lsv_Cut_t* pCut) {
+  static int s_Primes[LSV_CUT_SIZE_MAX] = {4177, 5147, 5647, 6343, 7103, 7873};
+  unsigned Key = 0;
+  int i;
+  for (i = 0; i < pCut->nLeaves; i++) Key += s_Primes[i] * (unsigned)pCut->pLeaves[i];
+  Key = (Key + (unsigned)pCut->nLeaves) * 0x9E3779B1u;
+  return Key ^ (Key >> 16);
+}
@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <queue>
+
+#include "ext-lsv/lsvInt.h"
+
+// the max number of runs merged at once
+#define LSV_RUN_FANIN 64
+// the size of the output buffer
+#define LSV_OUT_BUF_SIZE (1 << 16)
+
+// an occurrence of a cut at a node
+struct Lsv_CutRec_t {
+  int nLeaves;
+  int pLeaves[LSV_CUT_SIZE_MAX];
+  int iNode;
+};
+
+static inline int Lsv_CutRecCompare(const Lsv_CutRec_t* p0, const Lsv_CutRec_t* p1) {
+  int i, nSize = Abc_MinInt(p0->nLeaves, p1->nLeaves);
+  for (i = 0; i < nSize; i++)
+    if (p0->pLeaves[i] != p1->pLeaves[i]) return p0->pLeaves[i] < p1->pLeaves[i] ? -1 : 1;
+  return p0->nLeaves - p1->nLeaves;
+}
+// orders the records by leaves and then by node
+static inline bool Lsv_CutRecLess(const Lsv_CutRec_t& Rec0, const Lsv_CutRec_t& Rec1) {
+  int Value = Lsv_CutRecCompare(&Rec0, &Rec1);
+  return Value != 0 ? Value < 0 : Rec0.iNode < Rec1.iNode;
+}
+
+// a buffered reader of one sorted run
+class Lsv_RunReader {
+ public:
+  Lsv_RunReader(FILE* pFile, size_t nBufRecs) : pFile(pFile), vBuf(nBufRecs) {
+    rewind(pFile);
+    Refill();
+  }
+  bool Done() const { return iCur == nCur; }
+  const Lsv_CutRec_t& Top() const { return vBuf[iCur]; }
+  void Pop() {
+    if (++iCur == nCur) Refill();
+  }
+
+ private:
+  void Refill() {
+    nCur = fread(vBuf.data(), sizeof(Lsv_CutRec_t), vBuf.size(), pFile);
+    iCur = 0;
+  }
+  FILE* pFile;
+  std::vector<Lsv_CutRec_t> vBuf;
+  size_t iCur = 0;
+  size_t nCur = 0;
+};
+
+// the writer of multi-output cuts through a fixed-size buffer
+class Lsv_OutWriter {
+ public:
+  explicit Lsv_OutWriter(FILE* pFile) : pFile(pFile) {}
+  ~Lsv_OutWriter() { Flush(); }
+  void Write(const Lsv_CutRec_t& Rec, const std::vector<int>& vOuts) {
+    if (nUsed + 12 * (Rec.nLeaves + vOuts.size()) + 4 > LSV_OUT_BUF_SIZE) Flush();
+    if (12 * (Rec.nLeaves + vOuts.size()) + 4 > LSV_OUT_BUF_SIZE) {
+      WriteSlow(Rec, vOuts);
+      return;
+    }
+    for (int i = 0; i < Rec.nLeaves; i++) nUsed += sprintf(Buf + nUsed, "%d ", Rec.pLeaves[i]);
+    Buf[nUsed++] = ':';
+    for (int Out : vOuts) nUsed += sprintf(Buf + nUsed, " %d", Out);
+    Buf[nUsed++] = '\n';
+  }
+  void Flush() {
+    if (nUsed > 0 && fwrite(Buf, 1, nUsed, pFile) != nUsed) fError = true;
+    nUsed = 0;
+  }
+  // returns true if some output could not be written
+  bool Error() const { return fError; }
+
+ private:
+  void WriteSlow(const Lsv_CutRec_t& Rec, const std::vector<int>& vOuts) {
+    for (int i = 0; i < Rec.nLeaves; i++) fError |= fprintf(pFile, "%d ", Rec.pLeaves[i]) < 0;
+    fError |= fprintf(pFile, ":") < 0;
+    for (int Out : vOuts) fError |= fprintf(pFile, " %d", Out) < 0;
+    fError |= fprintf(pFile, "\n") < 0;
+  }
+  FILE* pFile;
+  char Buf[LSV_OUT_BUF_SIZE];
+  size_t nUsed = 0;
+  bool fError = false;  // the output file could not be written
+};
+
+// collects the occurrences of cuts in bounded per-thread buffers, spills
+// them as sorted runs into temporary files, and merges the runs into the
+// sorted list of multi-output cuts
+class Lsv_MoCutStream {
+ public:
+  Lsv_MoCutStream(int nThreads, size_t nMemBytes, const int* pMap) : vBufs(nThreads), pMap(pMap) {
+    nBufRecs = std::max<size_t>(1024, nMemBytes / sizeof(Lsv_CutRec_t) / nThreads);
+    for (std::vector<Lsv_CutRec_t>& vBuf : vBufs) vBuf.reserve(nBufRecs);
+  }
+  ~Lsv_MoCutStream() {
+    for (FILE* pRun : vRuns) fclose(pRun);
+  }
+  void Add(int iThread, const Lsv_Cut_t* pCut, int iNode) {
+    std::vector<Lsv_CutRec_t>& vBuf = vBufs[iThread];
+    Lsv_CutRec_t Rec;
+    Rec.nLeaves = pCut->nLeaves;
+    memcpy(Rec.pLeaves, pCut->pLeaves, sizeof(int) * pCut->nLeaves);
+    Rec.iNode = iNode;
+    if (pMap) {
+      Lsv_Cut_t Cut = *pCut;
+      Lsv_CutRemap(&Cut, pMap, NULL, 0);
+      memcpy(Rec.pLeaves, Cut.pLeaves, sizeof(int) * Cut.nLeaves);
+      Rec.iNode = pMap[iNode];
+    }
+    vBuf.push_back(Rec);
+    if (vBuf.size() == nBufRecs) Spill(vBuf);
+  }
+  // writes the cuts shared by at least nOutMin nodes; returns the number of
+  // cuts written, -1 if the temporary files could not be used, or -2 if the
+  // output file could not be written
+  long Finish(int nOutMin, FILE* pFile) {
+    for (std::vector<Lsv_CutRec_t>& vBuf : vBufs) Spill(vBuf);
+    if (fError) return -1;
+    nRunsAll = vRuns.size();
+    // reduce the number of runs so that the final merge reads few files
+    size_t nMergeRecs = nBufRecs * vBufs.size();
+    while (vRuns.size() > LSV_RUN_FANIN) {
+      std::vector<FILE*> vGroup(vRuns.begin(), vRuns.begin() + LSV_RUN_FANIN);
+      vRuns.erase(vRuns.begin(), vRuns.begin() + LSV_RUN_FANIN);
+      FILE* pRun = tmpfile();
+      if (pRun == nullptr) {
+        for (FILE* pGroup : vGroup) fclose(pGroup);
+        return -1;
+      }
+      bool fWritten = true;
+      Merge(vGroup, nMergeRecs, [&](const Lsv_CutRec_t& Rec) {
+        if (fWritten && fwrite(&Rec, sizeof(Lsv_CutRec_t), 1, pRun) != 1) fWritten = false;
+      });
+      for (FILE* pGroup : vGroup) fclose(pGroup);
+      if (!fWritten || fflush(pRun) != 0) {
+        fclose(pRun);
+        return -1;
+      }
+      vRuns.push_back(pRun);
+    }
+    // merge the remaining runs and group the nodes of each cut
+    Lsv_OutWriter* pWriter = new Lsv_OutWriter(pFile);
+    Lsv_CutRec_t Last;
+    std::vector<int> vOuts;
+    long nMoCuts = 0;
+    Last.nLeaves = -1;
+    auto Emit = [&]() {
+      if (Last.nLeaves >= 0 && (int)vOuts.size() >= nOutMin) pWriter->Write(Last, vOuts), nMoCuts++;
+      vOuts.clear();
+    };
+    Merge(vRuns, nMergeRecs, [&](const Lsv_CutRec_t& Rec) {
+      if (Last.nLeaves == -1 || Lsv_CutRecCompare(&Last, &Rec) != 0) {
+        Emit();
+        Last = Rec;
+      }
+      vOuts.push_back(Rec.iNode);
+    });
+    Emit();
+    pWriter->Flush();
+    if (pWriter->Error() || fflush(pFile) != 0) nMoCuts = -2;
+    delete pWriter;
+    return nMoCuts;
+  }
+  size_t RunNum() const { return nRunsAll; }
+  size_t RecNum() const { return nRecsAll; }
+
+ private:
+  // sorts the buffer and appends it to the list of runs
+  void Spill(std::vector<Lsv_CutRec_t>& vBuf) {
+    if (vBuf.empty()) return;
+    std::sort(vBuf.begin(), vBuf.end(), Lsv_CutRecLess);
+    FILE* pRun = tmpfile();
+    if (pRun == nullptr || fwrite(vBuf.data(), sizeof(Lsv_CutRec_t), vBuf.size(), pRun) != vBuf.size() ||
+        fflush(pRun) != 0) {
+      if (pRun) fclose(pRun);
+      fError = 1;
+    } else {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      vRuns.push_back(pRun);
+      nRecsAll += vBuf.size();
+    }
+    vBuf.clear();
+  }
+  // merges the runs and calls Emit for every record in the sorted order
+  template <class Func>
+  static void Merge(const std::vector<FILE*>& vFiles, size_t nMemRecs, Func Emit) {
+    size_t nBufRecs = std::max<size_t>(256, nMemRecs / std::max<size_t>(1, vFiles.size()));
+    std::vector<Lsv_RunReader*> vReaders;
+    for (FILE* pFile : vFiles) vReaders.push_back(new Lsv_RunReader(pFile, nBufRecs));
+    auto Greater = [&](int i, int k) { return Lsv_CutRecLess(vReaders[k]->Top(), vReaders[i]->Top()); };
+    std::priority_queue<int, std::vector<int>, decltype(Greater)> Heap(Greater);
+    for (size_t i = 0; i < vReaders.size(); i++)
+      if (!vReaders[i]->Done()) Heap.push((int)i);
+    while (!Heap.empty()) {
+      int i = Heap.top();
+      Heap.pop();
+      Emit(vReaders[i]->Top());
+      vReaders[i]->Pop();
+      if (!vReaders[i]->Done()) Heap.push(i);
+    }
+    for (Lsv_RunReader* pReader : vReaders) delete pReader;
+  }
+  std::vector<std::vector<Lsv_CutRec_t>> vBufs;  // the per-thread buffers
+  size_t nBufRecs;                               // the capacity of one buffer
+  const int* pMap;                               // the ID map applied to the records (or NULL)
+  std::vector<FILE*> vRuns;                      // the sorted runs
+  std::mutex Mutex;                              // guards the list of runs
+  size_t nRunsAll = 0;                           // the number of spilled runs
+  size_t nRecsAll = 0;                           // the number of spilled records
+  std::atomic<int> fError{0};                    // a temporary file could not be written (set by any thread)
+};
+
+// prints the multi-output cuts into the file without keeping all cuts in
+// memory: the cuts of a node are released as soon as its fanouts are
+// computed and the occurrences of cuts go through sorted runs on disk;
+// the IDs are translated through pMap if it is given; returns 0 on success
+static int Lsv_StreamMoCuts(int nObjs, const Lsv_EnumFunc_t& Enumerate, Lsv_MoCutPar_t* pPars, const int* pMap,
+                            FILE* pFile) {
+  abctime clk = Abc_Clock();
+  int nThreads = std::max(1, pPars->nThreads);
+  Lsv_Sto_t* pSto = Lsv_StoAlloc(nObjs, pPars->nCutSize, nThreads, 0);
+  Lsv_MoCutStream Stream(nThreads, (size_t)std::max(1, pPars->nStreamMem) << 20, pMap);
+  int nLevels = Enumerate(pSto, 1, [&](int iThread, int iObj) {
+    Lsv_Cut_t* pCuts = Lsv_StoObjCuts(pSto, iObj);
+    for (int c = 0; c < Lsv_StoObjCutNum(pSto, iObj); c++) Stream.Add(iThread, pCuts + c, iObj);
+  });
+  abctime clkEnum = Abc_Clock() - clk;
+  double MemSto = Lsv_StoMemory(pSto);
+  long nCuts = Lsv_StoCutNum(pSto);
+  Lsv_StoFree(pSto);
+  clk = Abc_Clock();
+  long nMoCuts = Stream.Finish(pPars->nOutMin, pFile);
+  if (nMoCuts < 0) {
+    if (nMoCuts == -1)
+      Abc_Print(-1, "Cannot write temporary files for the sorted runs.\n");
+    else
+      Abc_Print(-1, "Cannot write the multi-output cuts into the output file.\n");
+    return 1;
+  }
+  if (pPars->pStats) {
+    pPars->pStats->nLevels = nLevels;
+    pPars->pStats->nCuts = nCuts;
+    pPars->pStats->nMoCuts = nMoCuts;
+    pPars->pStats->MemSto = MemSto;
+    pPars->pStats->clkEnum = clkEnum;
+    pPars->pStats->clkCollect = Abc_Clock() - clk;
+  }
+  if (pPars->fVerbose) {
+    printf("Levels = %d. Threads = %d. Cut occurrences = %lu. Runs = %lu. Multi-output cuts = %ld. Store = %.2f MB.\n",
+           nLevels, nThreads, (unsigned long)Stream.RecNum(), (unsigned long)Stream.RunNum(), nMoCuts,
+           MemSto / (1 << 20));
+    Abc_PrintTime(1, "Enumeration", clkEnum);
+    Abc_PrintTime(1, "Merging    ", Abc_Clock() - clk);
+  }
+  return 0;
+}
+
+int Lsv_NtkStreamMoCuts(Abc_Ntk_t* pNtk, Lsv_MoCutPar_t* pPars, FILE* pFile) {
+  Lsv_EnumFunc_t Enumerate = [&](Lsv_Sto_t* pSto, int fRelease, const Lsv_VisitFunc_t& Visit) {
+    return Lsv_NtkEnumerateCuts(pNtk, pPars, pSto, fRelease, Visit);
+  };
+  return Lsv_StreamMoCuts(Abc_NtkObjNumMax(pNtk), Enumerate, pPars, NULL, pFile);
+}
+
+int Lsv_GiaStreamMoCuts(Gia_Man_t* p, Lsv_MoCutPar_t* pPars, Vec_Int_t* vMap, FILE* pFile) {
+  Lsv_EnumFunc_t Enumerate = [&](Lsv_Sto_t* pSto, int fRelease, const Lsv_VisitFunc_t& Visit) {
+    return Lsv_GiaEnumerateCuts(p, pPars, pSto, fRelease, Visit);
+  };
+  return Lsv_StreamMoCuts(Gia_ManObjNum(p), Enumerate, pPars, vMap ? Vec_IntArray(vMap) : NULL, pFile);
+}
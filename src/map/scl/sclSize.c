@@ -22,6 +22,7 @@
 #include "map/mio/mio.h"
 #include "misc/vec/vecWec.h"
 #include "base/main/main.h"
+#include "misc/util/utilJson.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -259,6 +260,76 @@ void Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writing timing information for the node/network into JSON.]
+
+  Description [Writes the same metrics as Abc_SclTimeNtkPrint().  The critical
+  path is written from the start-point to the end-point.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclTimeNodePrintJson( SC_Man * p, Json_Wrt_t * pJson, Abc_Obj_t * pObj )
+{
+    SC_Cell * pCell = Abc_ObjIsNode(pObj) ? Abc_SclObjCell(pObj) : NULL;
+    Json_WrtObjStart( pJson, NULL );
+    Json_WrtInt(   pJson, "id",      Abc_ObjId(pObj) );
+    Json_WrtInt(   pJson, "fanins",  Abc_ObjFaninNum(pObj) );
+    Json_WrtInt(   pJson, "fanouts", Abc_ObjFanoutNum(pObj) );
+    Json_WrtStr(   pJson, "cell",    pCell ? pCell->pName : Abc_ObjIsPi(pObj) ? "pi" : Abc_ObjIsPo(pObj) ? "po" : "none" );
+    Json_WrtFloat( pJson, "area",    pCell ? pCell->area : 0.0 );
+    Json_WrtFloat( pJson, "arrival", Abc_SclObjTimeMax(p, pObj) );
+    Json_WrtFloat( pJson, "slew",    Abc_SclObjSlewMax(p, pObj) );
+    Json_WrtFloat( pJson, "cin",     pCell ? SC_CellPinCapAve(pCell) : 0.0 );
+    Json_WrtFloat( pJson, "cout",    Abc_SclObjLoadMax(p, pObj) );
+    Json_WrtFloat( pJson, "cmax",    pCell ? SC_CellPin(pCell, pCell->n_inputs)->max_out_cap : 0.0 );
+    Json_WrtInt(   pJson, "gain",    pCell ? (int)(100.0 * Abc_SclObjLoadAve(p, pObj) / SC_CellPinCapAve(pCell)) : 0 );
+    Json_WrtObjStop( pJson );
+}
+void Abc_SclTimeNtkPrintJson( SC_Man * p, void * pJson, int fShowAll, int fPrintPath )
+{
+    Json_Wrt_t * pWrt = (Json_Wrt_t *)pJson;
+    int i, fRise = 0, nNodes = Abc_NtkNodeNum(p->pNtk);
+    Abc_Obj_t * pObj, * pPivot = Abc_SclFindCriticalCo( p, &fRise ); 
+    Json_WrtStr(   pWrt, "wireload",              p->pWLoadUsed ? p->pWLoadUsed->pName : "none" );
+    Json_WrtInt(   pWrt, "gates",                 nNodes );
+    Json_WrtFloat( pWrt, "bufinv_percent",        nNodes ? 100.0 * Abc_SclGetBufInvCount(p->pNtk) / nNodes : 0 );
+    Json_WrtFloat( pWrt, "cap_ave",               p->EstLoadAve );
+    Json_WrtFloat( pWrt, "size_ave_percent",      Abc_SclGetAverageSize(p->pNtk) );
+    Json_WrtFloat( pWrt, "area",                  Abc_SclGetTotalArea(p->pNtk) );
+    Json_WrtFloat( pWrt, "min_size_percent",      nNodes ? 100.0 * Abc_SclCountMinSize(p->pLib, p->pNtk, 0) / nNodes : 0 );
+    Json_WrtFloat( pWrt, "delay",                 Abc_SclObjTimeOne( p, pPivot, fRise ) );
+    Json_WrtFloat( pWrt, "near_critical_percent", nNodes ? 100.0 * Abc_SclCountNearCriticalNodes(p) / nNodes : 0 );
+    if ( fShowAll )
+    {
+        Json_WrtArrStart( pWrt, "nodes" );
+        Abc_NtkForEachNodeReverse( p->pNtk, pObj, i )
+            if ( Abc_ObjFaninNum(pObj) > 0 )
+                Abc_SclTimeNodePrintJson( p, pWrt, pObj );
+        Json_WrtArrStop( pWrt );
+    }
+    if ( fPrintPath )
+    {
+        // collect path nodes (the path cannot be longer than the number of objects)
+        Vec_Ptr_t * vPath = Vec_PtrAlloc( 100 );
+        Vec_PtrPush( vPath, pPivot );
+        pObj = Abc_ObjFanin0(pPivot);
+        while ( pObj && Vec_PtrSize(vPath) <= Abc_NtkObjNumMax(p->pNtk) )
+        {
+            Vec_PtrPush( vPath, pObj );
+            pObj = Abc_SclFindMostCriticalFanin( p, &fRise, pObj );
+        }
+        Json_WrtArrStart( pWrt, "path" );
+        Vec_PtrForEachEntryReverse( Abc_Obj_t *, vPath, pObj, i )
+            Abc_SclTimeNodePrintJson( p, pWrt, pObj );
+        Json_WrtArrStop( pWrt );
+        Vec_PtrFree( vPath );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Timing computation for pin/gate/cone/network.]
@@ -683,11 +754,17 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, char * pJsonFile )
 {
     SC_Man * p;
+    Json_Wrt_t * pJson;
     p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
+    if ( pJsonFile && (pJson = Json_WrtStart( pJsonFile, "stime" )) )
+    {
+        Abc_SclTimeNtkPrintJson( p, pJson, fShowAll, fPrintPath );
+        Json_WrtStop( pJson );
+    }
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
     Abc_SclManFree( p );
@@ -704,12 +781,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, char * pJsonFile )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, pJsonFile );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
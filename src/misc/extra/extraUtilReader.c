@@ -22,6 +22,16 @@
 #include "extra.h"
 #include "misc/vec/vec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 #if (__GNUC__ >= 8)
   #pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
 #endif
@@ -52,6 +62,14 @@ struct Extra_FileReader_t_
     char *           pBufferCur;    // the current reading position
     char *           pBufferEnd;    // the first position not used by currently loaded data
     char *           pBufferStop;   // the position where loading new data will be done
+    // read-ahead of the next chunk (double buffering)
+    char *           pPrefetch;     // the buffer where the next chunk is loaded
+    int              nFileFetched;  // the number of bytes requested from the file
+    int              nPrefetch;     // the number of bytes in the next chunk
+    int              fPrefetch;     // the next chunk is being loaded
+#ifdef ABC_USE_PTHREADS
+    pthread_t        Thread;        // the thread loading the next chunk
+#endif
     // tokens given to the user
     Vec_Ptr_t *      vTokens;       // the vector of tokens returned to the user
     Vec_Int_t *      vLines;        // the vector of line numbers for each token
@@ -71,6 +89,8 @@ typedef enum {
 // the static functions
 static void * Extra_FileReaderGetTokens_int( Extra_FileReader_t * p );
 static void Extra_FileReaderReload( Extra_FileReader_t * p );
+static void Extra_FileReaderPrefetchStart( Extra_FileReader_t * p );
+static void Extra_FileReaderPrefetchStop( Extra_FileReader_t * p );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -128,9 +148,16 @@ Extra_FileReader_t * Extra_FileReaderAlloc( char * pFileName,
     // load the first part into the buffer
     RetValue = fread( p->pBuffer, nCharsToRead, 1, p->pFile );
     p->nFileRead = nCharsToRead;
+    p->nFileFetched = nCharsToRead;
     // set the ponters to the end and the stopping point
     p->pBufferEnd  = p->pBuffer + nCharsToRead;
     p->pBufferStop = (p->nFileRead == p->nFileSize)? p->pBufferEnd : p->pBuffer + EXTRA_BUFFER_SIZE - EXTRA_OFFSET_SIZE;
+    // start loading the next chunk while the first one is parsed
+    if ( p->nFileFetched < p->nFileSize )
+    {
+        p->pPrefetch = ABC_ALLOC( char, EXTRA_BUFFER_SIZE+1 );
+        Extra_FileReaderPrefetchStart( p );
+    }
     // start the arrays
     p->vTokens = Vec_PtrAlloc( 100 );
     p->vLines = Vec_IntAlloc( 100 );
@@ -151,9 +178,11 @@ Extra_FileReader_t * Extra_FileReaderAlloc( char * pFileName,
 ***********************************************************************/
 void Extra_FileReaderFree( Extra_FileReader_t * p )
 {
+    Extra_FileReaderPrefetchStop( p );
     if ( p->pFile )
         fclose( p->pFile );
     ABC_FREE( p->pBuffer );
+    ABC_FREE( p->pPrefetch );
     Vec_PtrFree( p->vTokens );
     Vec_IntFree( p->vLines );
     ABC_FREE( p );
@@ -353,7 +382,52 @@ void * Extra_FileReaderGetTokens_int( Extra_FileReader_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    [Loads new data into the file reader.]
+  Synopsis    [Loads the next chunk of the file into the prefetch buffer.]
+
+  Description [The chunk is placed after the first EXTRA_OFFSET_SIZE bytes
+  of the buffer, leaving room for the unprocessed tail of the current one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Extra_FileReaderPrefetch( void * pArg )
+{
+    Extra_FileReader_t * p = (Extra_FileReader_t *)pArg;
+    int nCharsToRead = EXTRA_MINIMUM( EXTRA_BUFFER_SIZE - EXTRA_OFFSET_SIZE, p->nFileSize - p->nFileFetched );
+    p->nPrefetch = (int)fread( p->pPrefetch + EXTRA_OFFSET_SIZE, 1, nCharsToRead, p->pFile );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts loading the next chunk.]
+
+  Description [With pthreads, the chunk is read by a background thread
+  while the current one is being tokenized.  Otherwise, it is read here.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Extra_FileReaderPrefetchStart( Extra_FileReader_t * p )
+{
+    assert( !p->fPrefetch );
+    assert( p->nFileFetched < p->nFileSize );
+    p->fPrefetch = 1;
+#ifdef ABC_USE_PTHREADS
+    if ( pthread_create( &p->Thread, NULL, Extra_FileReaderPrefetch, (void *)p ) == 0 )
+        return;
+#endif
+    Extra_FileReaderPrefetch( p );
+    p->fPrefetch = 2;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits till the next chunk is loaded.]
 
   Description []
                
@@ -361,27 +435,57 @@ void * Extra_FileReaderGetTokens_int( Extra_FileReader_t * p )
 
   SeeAlso     []
 
+***********************************************************************/
+void Extra_FileReaderPrefetchStop( Extra_FileReader_t * p )
+{
+    if ( !p->fPrefetch )
+        return;
+#ifdef ABC_USE_PTHREADS
+    if ( p->fPrefetch == 1 )
+        pthread_join( p->Thread, NULL );
+#endif
+    p->fPrefetch = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads new data into the file reader.]
+
+  Description [Takes the chunk loaded by the prefetch, prepends to it the
+  unprocessed part of the current buffer, swaps the buffers, and starts
+  loading the following chunk.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 void Extra_FileReaderReload( Extra_FileReader_t * p )
 {
-    int nCharsUsed, nCharsToRead;
-    int RetValue;
+    char * pTemp;
+    int nCharsUsed;
     assert( !p->fStop );
     assert( p->pBufferCur > p->pBufferStop );
     assert( p->pBufferCur < p->pBufferEnd );
+    // wait for the next chunk
+    Extra_FileReaderPrefetchStop( p );
+    if ( p->nPrefetch < EXTRA_MINIMUM( EXTRA_BUFFER_SIZE - EXTRA_OFFSET_SIZE, p->nFileSize - p->nFileFetched ) )
+        p->nFileSize = p->nFileFetched + p->nPrefetch; // the file was truncated
+    p->nFileFetched += p->nPrefetch;
     // figure out how many chars are still not processed
     nCharsUsed = p->pBufferEnd - p->pBufferCur;
-    // move the remaining data to the beginning of the buffer
-    memmove( p->pBuffer, p->pBufferCur, (size_t)nCharsUsed );
-    p->pBufferCur = p->pBuffer;
-    // determine how many chars we will read
-    nCharsToRead = EXTRA_MINIMUM( p->nBufferSize - nCharsUsed, p->nFileSize - p->nFileRead );
-    // read the chars
-    RetValue = fread( p->pBuffer + nCharsUsed, nCharsToRead, 1, p->pFile );
-    p->nFileRead += nCharsToRead;
+    assert( nCharsUsed < EXTRA_OFFSET_SIZE );
+    // move the remaining data in front of the new chunk
+    memcpy( p->pPrefetch + EXTRA_OFFSET_SIZE - nCharsUsed, p->pBufferCur, (size_t)nCharsUsed );
+    pTemp = p->pBuffer; p->pBuffer = p->pPrefetch; p->pPrefetch = pTemp;
+    p->pBufferCur = p->pBuffer + EXTRA_OFFSET_SIZE - nCharsUsed;
+    p->nFileRead += p->nPrefetch;
     // set the ponters to the end and the stopping point
-    p->pBufferEnd  = p->pBuffer + nCharsUsed + nCharsToRead;
-    p->pBufferStop = (p->nFileRead == p->nFileSize)? p->pBufferEnd : p->pBuffer + EXTRA_BUFFER_SIZE - EXTRA_OFFSET_SIZE;
+    p->pBufferEnd  = p->pBuffer + EXTRA_OFFSET_SIZE + p->nPrefetch;
+    p->pBufferStop = (p->nFileRead == p->nFileSize)? p->pBufferEnd : p->pBufferEnd - EXTRA_OFFSET_SIZE;
+    // start loading the following chunk
+    if ( p->nFileFetched < p->nFileSize )
+        Extra_FileReaderPrefetchStart( p );
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -97,6 +97,24 @@ int Nm_ManNumEntries( Nm_Man_t * p )
     return p->nEntries;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Makes room for the given number of new entries.]
+
+  Description [Resizes the tables once, so that adding the entries does
+  not lead to several resizings.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManReserve( Nm_Man_t * p, int nEntries )
+{
+    if ( p->nEntries + nEntries > p->nBins * p->nSizeFactor )
+        Nm_ManTableResize( p, Abc_PrimeCudd( p->nEntries + nEntries ) );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates a new entry in the name manager.]
@@ -254,14 +254,28 @@ void Nm_ManProfile( Nm_Man_t * p )
 
 ***********************************************************************/
 void Nm_ManResize( Nm_Man_t * p )
+{
+    Nm_ManTableResize( p, Abc_PrimeCudd( p->nGrowthFactor * p->nBins ) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes the entries into the table of the given size.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManTableResize( Nm_Man_t * p, int nBinsNew )
 {
     Nm_Entry_t ** pBinsNewI2N, ** pBinsNewN2I, * pEntry, * pEntry2, ** ppSpot;
-    int nBinsNew, Counter, e;
+    int Counter, e;
     abctime clk;
 
 clk = Abc_Clock();
-    // get the new table size
-    nBinsNew = Abc_PrimeCudd( p->nGrowthFactor * p->nBins ); 
     // allocate a new array
     pBinsNewI2N = ABC_ALLOC( Nm_Entry_t *, nBinsNew );
     pBinsNewN2I = ABC_ALLOC( Nm_Entry_t *, nBinsNew );
@@ -555,6 +555,7 @@ extern word     Abc_RandomW( int fReset );
 
 // pthreads
 extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
+extern void Util_ProcessThreadsRounds( int (*pRoundFunc)(void *), void (*pUserFunc)(void *, int), void * pData, int nProcs );
 
 ABC_NAMESPACE_HEADER_END
 
@@ -0,0 +1,171 @@
+/**CFile****************************************************************
+
+  FileName    [utilJson.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Utility functions.]
+
+  Synopsis    [Writing statistics in JSON.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "utilJson.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts writing one JSON record with statistics.]
+
+  Description [The record is appended to the file as one line (JSON Lines),
+  so that the statistics of several commands can be collected in the same
+  file.  The record is an object whose first field is the command name.
+  Returns NULL if the file cannot be opened.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Json_Wrt_t * Json_WrtStart( char * pFileName, char * pCommand )
+{
+    Json_Wrt_t * p;
+    FILE * pFile = fopen( pFileName, "ab" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        return NULL;
+    }
+    p = ABC_CALLOC( Json_Wrt_t, 1 );
+    p->pFile = pFile;
+    Json_WrtObjStart( p, NULL );
+    Json_WrtStr( p, "command", pCommand );
+    return p;
+}
+void Json_WrtStop( Json_Wrt_t * p )
+{
+    Json_WrtObjStop( p );
+    assert( p->nLevel == 0 );
+    fprintf( p->pFile, "\n" );
+    fclose( p->pFile );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the key of the next value.]
+
+  Description [Values inside arrays have no key.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Json_WrtString( FILE * pFile, char * pStr )
+{
+    fputc( '\"', pFile );
+    for ( ; pStr && *pStr; pStr++ )
+        if ( *pStr == '\"' || *pStr == '\\' )
+            fprintf( pFile, "\\%c", *pStr );
+        else if ( (unsigned char)*pStr < 0x20 )
+            fprintf( pFile, "\\u%04x", (unsigned char)*pStr );
+        else
+            fputc( *pStr, pFile );
+    fputc( '\"', pFile );
+}
+static void Json_WrtKey( Json_Wrt_t * p, char * pKey )
+{
+    if ( p->nLevel > 0 && p->nItems[p->nLevel-1]++ > 0 )
+        fputc( ',', p->pFile );
+    if ( pKey == NULL )
+        return;
+    Json_WrtString( p->pFile, pKey );
+    fputc( ':', p->pFile );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes objects, arrays and values.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Json_WrtObjStart( Json_Wrt_t * p, char * pKey )
+{
+    assert( p->nLevel < JSON_WRT_LEVELS );
+    Json_WrtKey( p, pKey );
+    fputc( '{', p->pFile );
+    p->nItems[p->nLevel++] = 0;
+}
+void Json_WrtObjStop( Json_Wrt_t * p )
+{
+    assert( p->nLevel > 0 );
+    fputc( '}', p->pFile );
+    p->nLevel--;
+}
+void Json_WrtArrStart( Json_Wrt_t * p, char * pKey )
+{
+    assert( p->nLevel < JSON_WRT_LEVELS );
+    Json_WrtKey( p, pKey );
+    fputc( '[', p->pFile );
+    p->nItems[p->nLevel++] = 0;
+}
+void Json_WrtArrStop( Json_Wrt_t * p )
+{
+    assert( p->nLevel > 0 );
+    fputc( ']', p->pFile );
+    p->nLevel--;
+}
+void Json_WrtInt( Json_Wrt_t * p, char * pKey, int Value )
+{
+    Json_WrtKey( p, pKey );
+    fprintf( p->pFile, "%d", Value );
+}
+void Json_WrtFloat( Json_Wrt_t * p, char * pKey, double Value )
+{
+    Json_WrtKey( p, pKey );
+    if ( Value != Value || Value - Value != 0 ) // NaN or infinity
+        fprintf( p->pFile, "null" );
+    else
+        fprintf( p->pFile, "%.10g", Value );
+}
+void Json_WrtStr( Json_Wrt_t * p, char * pKey, char * pValue )
+{
+    Json_WrtKey( p, pKey );
+    if ( pValue == NULL )
+        fprintf( p->pFile, "null" );
+    else
+        Json_WrtString( p->pFile, pValue );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,70 @@
+/**CFile****************************************************************
+
+  FileName    [utilJson.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Utility functions.]
+
+  Synopsis    [Writing statistics in JSON.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+ 
+#ifndef ABC__misc__util__utilJson_h
+#define ABC__misc__util__utilJson_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define JSON_WRT_LEVELS 16
+
+typedef struct Json_Wrt_t_ Json_Wrt_t;
+struct Json_Wrt_t_
+{
+    FILE *          pFile;         // the output file
+    int             nLevel;        // the number of open objects and arrays
+    int             nItems[JSON_WRT_LEVELS]; // the number of items written on each level
+};
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilJson.c ==============================================================*/
+extern Json_Wrt_t *       Json_WrtStart( char * pFileName, char * pCommand );
+extern void               Json_WrtStop( Json_Wrt_t * p );
+extern void               Json_WrtObjStart( Json_Wrt_t * p, char * pKey );
+extern void               Json_WrtObjStop( Json_Wrt_t * p );
+extern void               Json_WrtArrStart( Json_Wrt_t * p, char * pKey );
+extern void               Json_WrtArrStop( Json_Wrt_t * p );
+extern void               Json_WrtInt( Json_Wrt_t * p, char * pKey, int Value );
+extern void               Json_WrtFloat( Json_Wrt_t * p, char * pKey, double Value );
+extern void               Json_WrtStr( Json_Wrt_t * p, char * pKey, char * pValue );
+
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
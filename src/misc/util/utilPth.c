@@ -73,6 +73,13 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
     Vec_PtrForEachEntry( void *, (Vec_Ptr_t *)vData, pData, i )
         pUserFunc( pData );
 }
+void Util_ProcessThreadsRounds( int (*pRoundFunc)(void *), void (*pUserFunc)(void *, int), void * pData, int nProcs )
+{
+    int i;
+    while ( pRoundFunc( pData ) )
+        for ( i = 0; i < nProcs; i++ )
+            pUserFunc( pData, i );
+}
 
 #else // pthreads are used
 
@@ -180,6 +187,131 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
     //    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );    
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs rounds of work by a team of threads.]
+
+  Description [Before each round, pRoundFunc() is called by the calling 
+  thread alone to prepare the round; it returns 0 when there is no more 
+  work.  In each round, pUserFunc() is called concurrently by nProcs threads 
+  with the thread number from 0 to nProcs-1 (the calling thread is number 0),
+  and the round ends when all the calls have returned.  Unlike calling 
+  Util_ProcessThreads() for each round, the threads are created once and 
+  wait for the next round on a condition variable, so that the rounds can 
+  be short.  If nProcs exceeds the precompiled limit, only PAR_THR_MAX 
+  threads are started and each of them makes the calls for several thread 
+  numbers one after another.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Util_RoundsData_t_
+{
+    void *       pUserData;
+    void       (*pUserFunc)(void *, int);
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;
+    pthread_cond_t  CondDone;
+    int          iRound;      // the number of the current round
+    int          nBusy;       // the number of workers busy in this round
+    int          fStop;       // the workers should quit
+} Util_RoundsData_t;
+
+typedef struct Util_RoundsThread_t_
+{
+    Util_RoundsData_t * p;
+    int          iThread;     // the first thread number of this thread
+    int          nThreads;    // the number of threads started
+    int          nProcs;      // the number of thread numbers
+} Util_RoundsThread_t;
+
+static void Util_ThreadRoundsCall( Util_RoundsThread_t * pThread )
+{
+    int i;
+    for ( i = pThread->iThread; i < pThread->nProcs; i += pThread->nThreads )
+        pThread->p->pUserFunc( pThread->p->pUserData, i );
+}
+
+void * Util_ThreadRounds( void * pArg )
+{
+    Util_RoundsThread_t * pThread = (Util_RoundsThread_t *)pArg;
+    Util_RoundsData_t * p = pThread->p;
+    int iRound = 0;
+    pthread_mutex_lock( &p->Mutex );
+    while ( 1 )
+    {
+        while ( p->iRound == iRound && !p->fStop )
+            pthread_cond_wait( &p->CondStart, &p->Mutex );
+        if ( p->fStop )
+            break;
+        iRound = p->iRound;
+        pthread_mutex_unlock( &p->Mutex );
+        Util_ThreadRoundsCall( pThread );
+        pthread_mutex_lock( &p->Mutex );
+        if ( --p->nBusy == 0 )
+            pthread_cond_signal( &p->CondDone );
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return NULL;
+}
+void Util_ProcessThreadsRounds( int (*pRoundFunc)(void *), void (*pUserFunc)(void *, int), void * pData, int nProcs )
+{
+    Util_RoundsData_t Data, * p = &Data;
+    Util_RoundsThread_t Threads[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    int i, status, nThreads = Abc_MinInt( nProcs, PAR_THR_MAX );
+    if ( nProcs <= 1 )
+    {
+        while ( pRoundFunc( pData ) )
+            pUserFunc( pData, 0 );
+        return;
+    }
+    memset( p, 0, sizeof(Util_RoundsData_t) );
+    p->pUserData = pData;
+    p->pUserFunc = pUserFunc;
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->CondStart, NULL );
+    pthread_cond_init( &p->CondDone, NULL );
+    // start the workers (the calling thread is thread 0)
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Threads[i].p        = p;
+        Threads[i].iThread  = i;
+        Threads[i].nThreads = nThreads;
+        Threads[i].nProcs   = nProcs;
+    }
+    for ( i = 1; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Util_ThreadRounds, (void *)(Threads + i) );  assert( status == 0 );
+    }
+    // perform the rounds
+    while ( pRoundFunc( pData ) )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        p->nBusy = nThreads - 1;
+        p->iRound++;
+        pthread_cond_broadcast( &p->CondStart );
+        pthread_mutex_unlock( &p->Mutex );
+        Util_ThreadRoundsCall( Threads );
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nBusy > 0 )
+            pthread_cond_wait( &p->CondDone, &p->Mutex );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    // stop the workers
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->CondStart );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_cond_destroy( &p->CondStart );
+    pthread_cond_destroy( &p->CondDone );
+    pthread_mutex_destroy( &p->Mutex );
+}
+
 #endif // pthreads are used
 
 
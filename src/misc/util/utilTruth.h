@@ -163,6 +163,12 @@ static inline int Abc_TtBitCount16( int i ) { return __builtin_popcount( i & 0xf
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== utilTtSimd.c ==========================================================*/
+extern int  Abc_TtSimdLevel();
+extern int  Abc_TtSimdSetLimit( int Limit );
+extern void Abc_TtAndMasked( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Mask0, unsigned Mask1, int nWords );
+extern int  Abc_TtAndMaskedIsZero( unsigned * pIn0, unsigned * pIn1, unsigned * pIn2, unsigned * pCare, unsigned Mask0, unsigned Mask1, unsigned MaskF, unsigned Mask2, int nWords );
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -0,0 +1,300 @@
+/**CFile****************************************************************
+
+  FileName    [utilTtSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Truth table manipulation.]
+
+  Synopsis    [Truth table operations with SIMD instructions.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "misc/util/abc_global.h"
+#include "misc/util/utilTruth.h"
+
+// the AVX2/AVX-512 code is compiled for the target of each function and selected at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ABC_TT_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the shortest truth tables, for which the SIMD code is used
+#define ABC_TT_SIMD_MIN  16
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar versions.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_TtAndMaskedScalar( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Mask0, unsigned Mask1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1);
+}
+static int Abc_TtAndMaskedIsZeroScalar( unsigned * pIn0, unsigned * pIn1, unsigned * pIn2, unsigned * pCare, unsigned Mask0, unsigned Mask1, unsigned MaskF, unsigned Mask2, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( (((pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1)) ^ MaskF) & (pIn2[w] ^ Mask2) & pCare[w] )
+            return 0;
+    return 1;
+}
+
+#ifdef ABC_TT_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 versions.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Abc_TtAndMaskedAvx2( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Mask0, unsigned Mask1, int nWords )
+{
+    __m256i M0 = _mm256_set1_epi32( (int)Mask0 );
+    __m256i M1 = _mm256_set1_epi32( (int)Mask1 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m256i A = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn0 + w)), M0 );
+        __m256i B = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn1 + w)), M1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(A, B) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1);
+}
+__attribute__((target("avx2")))
+static int Abc_TtAndMaskedIsZeroAvx2( unsigned * pIn0, unsigned * pIn1, unsigned * pIn2, unsigned * pCare, unsigned Mask0, unsigned Mask1, unsigned MaskF, unsigned Mask2, int nWords )
+{
+    __m256i M0 = _mm256_set1_epi32( (int)Mask0 );
+    __m256i M1 = _mm256_set1_epi32( (int)Mask1 );
+    __m256i MF = _mm256_set1_epi32( (int)MaskF );
+    __m256i M2 = _mm256_set1_epi32( (int)Mask2 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m256i A = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn0 + w)), M0 );
+        __m256i B = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn1 + w)), M1 );
+        __m256i C = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pIn2 + w)), M2 );
+        __m256i R = _mm256_and_si256( _mm256_xor_si256(_mm256_and_si256(A, B), MF), C );
+        R = _mm256_and_si256( R, _mm256_loadu_si256((const __m256i *)(pCare + w)) );
+        if ( !_mm256_testz_si256(R, R) )
+            return 0;
+    }
+    for ( ; w < nWords; w++ )
+        if ( (((pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1)) ^ MaskF) & (pIn2[w] ^ Mask2) & pCare[w] )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 versions.]
+
+  Description [The check takes two ternary-logic instructions per block.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Abc_TtAndMaskedAvx512( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Mask0, unsigned Mask1, int nWords )
+{
+    __m512i M0 = _mm512_set1_epi32( (int)Mask0 );
+    __m512i M1 = _mm512_set1_epi32( (int)Mask1 );
+    int w;
+    for ( w = 0; w + 16 <= nWords; w += 16 )
+    {
+        __m512i A = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn0 + w)), M0 );
+        __m512i B = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn1 + w)), M1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(A, B) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1);
+}
+__attribute__((target("avx512f")))
+static int Abc_TtAndMaskedIsZeroAvx512( unsigned * pIn0, unsigned * pIn1, unsigned * pIn2, unsigned * pCare, unsigned Mask0, unsigned Mask1, unsigned MaskF, unsigned Mask2, int nWords )
+{
+    __m512i M0 = _mm512_set1_epi32( (int)Mask0 );
+    __m512i M1 = _mm512_set1_epi32( (int)Mask1 );
+    __m512i MF = _mm512_set1_epi32( (int)MaskF );
+    __m512i M2 = _mm512_set1_epi32( (int)Mask2 );
+    int w;
+    for ( w = 0; w + 16 <= nWords; w += 16 )
+    {
+        __m512i A = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn0 + w)), M0 );
+        __m512i B = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn1 + w)), M1 );
+        __m512i C = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pIn2 + w)), M2 );
+        // 0x6A is (A & B) ^ F for the operands (A, B, F)
+        __m512i R = _mm512_ternarylogic_epi32( A, B, MF, 0x6A );
+        // 0x80 is A & B & C for the operands (A, B, C)
+        R = _mm512_ternarylogic_epi32( R, C, _mm512_loadu_si512((const void *)(pCare + w)), 0x80 );
+        if ( _mm512_test_epi32_mask(R, R) )
+            return 0;
+    }
+    for ( ; w < nWords; w++ )
+        if ( (((pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1)) ^ MaskF) & (pIn2[w] ^ Mask2) & pCare[w] )
+            return 0;
+    return 1;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the instruction set used by the SIMD operations.]
+
+  Description [Returns 2 for AVX-512, 1 for AVX2, and 0 if the scalar code
+  is used.  The CPU is checked on the first call and the result is cached.
+  The check is idempotent: if several threads make the first call at the
+  same time, each of them stores the same value.  The level is limited by
+  Abc_TtSimdSetLimit().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_TT_SIMD_X86
+static int s_TtSimdLevel = -1;   // the level supported by the CPU (-1 if not checked)
+static int s_TtSimdLimit =  2;   // the highest level allowed
+#endif
+int Abc_TtSimdLevel()
+{
+#ifdef ABC_TT_SIMD_X86
+    int Level = __atomic_load_n( &s_TtSimdLevel, __ATOMIC_RELAXED );
+    if ( Level < 0 )
+    {
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports("avx512f") )
+            Level = 2;
+        else if ( __builtin_cpu_supports("avx2") )
+            Level = 1;
+        else
+            Level = 0;
+        __atomic_store_n( &s_TtSimdLevel, Level, __ATOMIC_RELAXED );
+    }
+    return Abc_MinInt( Level, __atomic_load_n( &s_TtSimdLimit, __ATOMIC_RELAXED ) );
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Limits the instruction set used by the SIMD operations.]
+
+  Description [Makes the operations use the scalar code (Limit = 0), at
+  most AVX2 (Limit = 1), or the best available code (Limit = 2).  Used to
+  compare the versions with each other.  Returns the previous limit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtSimdSetLimit( int Limit )
+{
+#ifdef ABC_TT_SIMD_X86
+    assert( Limit >= 0 && Limit <= 2 );
+    return __atomic_exchange_n( &s_TtSimdLimit, Limit, __ATOMIC_RELAXED );
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the AND of two truth tables with complemented inputs.]
+
+  Description [Each word of the result is (pIn0 ^ Mask0) & (pIn1 ^ Mask1),
+  where the masks are 0 or ~0.  The output can be the same as an input.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtAndMasked( unsigned * pOut, unsigned * pIn0, unsigned * pIn1, unsigned Mask0, unsigned Mask1, int nWords )
+{
+#ifdef ABC_TT_SIMD_X86
+    if ( nWords >= ABC_TT_SIMD_MIN )
+    {
+        int Level = Abc_TtSimdLevel();
+        if ( Level == 2 )
+            { Abc_TtAndMaskedAvx512( pOut, pIn0, pIn1, Mask0, Mask1, nWords ); return; }
+        if ( Level == 1 )
+            { Abc_TtAndMaskedAvx2( pOut, pIn0, pIn1, Mask0, Mask1, nWords ); return; }
+    }
+#endif
+    Abc_TtAndMaskedScalar( pOut, pIn0, pIn1, Mask0, Mask1, nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks containment of the AND of two truth tables.]
+
+  Description [Returns 1 if ((pIn0 ^ Mask0) & (pIn1 ^ Mask1) ^ MaskF) &
+  (pIn2 ^ Mask2) & pCare is zero in every word, where the masks are 0 or ~0.
+  With MaskF = ~0 and the input masks complemented, the AND becomes an OR.
+  Quits at the first non-zero block of words.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtAndMaskedIsZero( unsigned * pIn0, unsigned * pIn1, unsigned * pIn2, unsigned * pCare, unsigned Mask0, unsigned Mask1, unsigned MaskF, unsigned Mask2, int nWords )
+{
+#ifdef ABC_TT_SIMD_X86
+    if ( nWords >= ABC_TT_SIMD_MIN )
+    {
+        int Level = Abc_TtSimdLevel();
+        if ( Level == 2 )
+            return Abc_TtAndMaskedIsZeroAvx512( pIn0, pIn1, pIn2, pCare, Mask0, Mask1, MaskF, Mask2, nWords );
+        if ( Level == 1 )
+            return Abc_TtAndMaskedIsZeroAvx2( pIn0, pIn1, pIn2, pCare, Mask0, Mask1, MaskF, Mask2, nWords );
+    }
+#endif
+    return Abc_TtAndMaskedIsZeroScalar( pIn0, pIn1, pIn2, pCare, Mask0, Mask1, MaskF, Mask2, nWords );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -47,6 +47,8 @@ struct Dar_RwrPar_t_
     int              nCutsMax;       // the maximum number of cuts to try
     int              nSubgMax;       // the maximum number of subgraphs to try
     int              nMinSaved;      // the minumum number of nodes saved
+    int              nProcs;         // the number of threads for concurrent rewriting
+    int              nWinSize;       // the number of nodes in one window (0 = automatic)
     int              fFanout;        // support fanout representation
     int              fUpdateLevel;   // update level 
     int              fUseZeros;      // performs zero-cost replacement
@@ -93,6 +95,8 @@ extern void            Dar_BalancePrintStats( Aig_Man_t * p );
 extern void            Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars );
 extern int             Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 extern Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int fVerbose );
+/*=== darPar.c ========================================================*/
+extern Aig_Man_t *     Dar_ManRewritePar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 /*=== darRefact.c ========================================================*/
 extern void            Dar_ManDefaultRefParams( Dar_RefPar_t * pPars );
 extern int             Dar_ManRefactor( Aig_Man_t * pAig, Dar_RefPar_t * pPars );
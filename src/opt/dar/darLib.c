@@ -105,7 +105,15 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
-static Dar_Lib_t * s_DarLib = NULL;
+static Dar_Lib_t * s_DarLibMain = NULL;
+// private copy of the library used by a concurrent rewriting thread
+// (the evaluation reuses the object numbers and the data as scratch space)
+#ifdef _MSC_VER
+static __declspec(thread) Dar_Lib_t * s_DarLibThread = NULL;
+#else
+static __thread Dar_Lib_t * s_DarLibThread = NULL;
+#endif
+#define s_DarLib (s_DarLibThread ? s_DarLibThread : s_DarLibMain)
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -593,10 +601,10 @@ Dar_Lib_t * Dar_LibRead()
 void Dar_LibStart()
 {
 //    abctime clk = Abc_Clock();
-    if ( s_DarLib != NULL )
+    if ( s_DarLibMain != NULL )
         return;
-    assert( s_DarLib == NULL );
-    s_DarLib = Dar_LibRead();
+    assert( s_DarLibMain == NULL );
+    s_DarLibMain = Dar_LibRead();
 //    printf( "The 4-input library started with %d nodes and %d subgraphs. ", s_DarLib->nObjs - 4, s_DarLib->nSubgrTotal );
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
@@ -614,9 +622,42 @@ void Dar_LibStart()
 ***********************************************************************/
 void Dar_LibStop()
 {
-    assert( s_DarLib != NULL );
-    Dar_LibFree( s_DarLib );
-    s_DarLib = NULL;
+    assert( s_DarLibMain != NULL );
+    Dar_LibFree( s_DarLibMain );
+    s_DarLibMain = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts/stops the private copy of the library in this thread.]
+
+  Description [The library should be prepared by Dar_LibPrepare() before
+  the copy is made.  The copy shares the read-only tables with the main
+  library and duplicates the objects and the data, which are modified
+  while the cuts are evaluated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibStartThread()
+{
+    Dar_Lib_t * p;
+    assert( s_DarLibMain != NULL && s_DarLibThread == NULL );
+    p = ABC_ALLOC( Dar_Lib_t, 1 );
+    memcpy( p, s_DarLibMain, sizeof(Dar_Lib_t) );
+    p->pObjs  = ABC_ALLOC( Dar_LibObj_t, p->nObjs );
+    memcpy( p->pObjs, s_DarLibMain->pObjs, sizeof(Dar_LibObj_t) * p->nObjs );
+    p->pDatas = ABC_CALLOC( Dar_LibDat_t, p->nDatas );
+    s_DarLibThread = p;
+}
+void Dar_LibStopThread()
+{
+    assert( s_DarLibThread != NULL );
+    ABC_FREE( s_DarLibThread->pObjs );
+    ABC_FREE( s_DarLibThread->pDatas );
+    ABC_FREE( s_DarLibThread );
 }
 
 /**Function*************************************************************
@@ -0,0 +1,247 @@
+/**CFile****************************************************************
+
+  FileName    [darPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting.]
+
+  Synopsis    [Concurrent rewriting of AIG windows.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "darInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Dar_ParWin_t_ Dar_ParWin_t;
+struct Dar_ParWin_t_
+{
+    Aig_Man_t *      pWin;           // the window (the boundary is represented by CIs/COs)
+    Vec_Ptr_t *      vIns;           // the nodes of the original AIG feeding into the window
+    Vec_Ptr_t *      vOuts;          // the nodes of the original AIG driven by the window
+    Dar_RwrPar_t     Pars;           // the private copy of the parameters
+    int              nNodesBeg;      // the number of nodes before rewriting
+    int              nNodesEnd;      // the number of nodes after rewriting
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Extracts one window of the AIG.]
+
+  Description [The window is composed of the nodes in the array. The fanins
+  outside of the window become CIs and the nodes with fanouts outside of the
+  window (marked with fMarkA) become COs, so that the boundary is frozen.]
+
+  SideEffects [Uses pData of the objects of the original AIG.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Obj_t * Dar_ManWindowFanin( Aig_Man_t * p, Dar_ParWin_t * pWin, Aig_Obj_t * pFanin )
+{
+    if ( Aig_ObjIsConst1(pFanin) )
+        return Aig_ManConst1(pWin->pWin);
+    if ( !Aig_ObjIsTravIdCurrent(p, pFanin) )
+    {
+        Aig_ObjSetTravIdCurrent( p, pFanin );
+        pFanin->pData = Aig_ObjCreateCi( pWin->pWin );
+        Vec_PtrPush( pWin->vIns, pFanin );
+    }
+    return (Aig_Obj_t *)pFanin->pData;
+}
+static void Dar_ManWindowExtract( Aig_Man_t * p, Dar_ParWin_t * pWin, Vec_Ptr_t * vNodes, int iBeg, int iEnd )
+{
+    Aig_Obj_t * pObj, * pFanin0, * pFanin1;
+    int i;
+    pWin->pWin  = Aig_ManStart( iEnd - iBeg );
+    pWin->vIns  = Vec_PtrAlloc( 100 );
+    pWin->vOuts = Vec_PtrAlloc( 100 );
+    pWin->pWin->Time2Quit = p->Time2Quit;
+    // the nodes of the window are current, so they are not treated as fanins
+    Aig_ManIncrementTravId( p );
+    for ( i = iBeg; i < iEnd; i++ )
+        Aig_ObjSetTravIdCurrent( p, (Aig_Obj_t *)Vec_PtrEntry(vNodes, i) );
+    // the nodes come in a topological order
+    for ( i = iBeg; i < iEnd; i++ )
+    {
+        pObj = (Aig_Obj_t *)Vec_PtrEntry( vNodes, i );
+        pFanin0 = Dar_ManWindowFanin( p, pWin, Aig_ObjFanin0(pObj) );
+        pFanin1 = Dar_ManWindowFanin( p, pWin, Aig_ObjFanin1(pObj) );
+        pObj->pData = Aig_And( pWin->pWin, Aig_NotCond(pFanin0, Aig_ObjFaninC0(pObj)), Aig_NotCond(pFanin1, Aig_ObjFaninC1(pObj)) );
+    }
+    for ( i = iBeg; i < iEnd; i++ )
+    {
+        pObj = (Aig_Obj_t *)Vec_PtrEntry( vNodes, i );
+        if ( !pObj->fMarkA )
+            continue;
+        Aig_ObjCreateCo( pWin->pWin, (Aig_Obj_t *)pObj->pData );
+        Vec_PtrPush( pWin->vOuts, pObj );
+    }
+    Aig_ManSetRegNum( pWin->pWin, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites one window.]
+
+  Description [Called by the worker threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dar_ManRewriteWindow( void * pArg )
+{
+    Dar_ParWin_t * pWin = (Dar_ParWin_t *)pArg;
+    Dar_LibStartThread();
+    pWin->nNodesBeg = Aig_ManNodeNum( pWin->pWin );
+    Dar_ManRewrite( pWin->pWin, &pWin->Pars );
+    pWin->nNodesEnd = Aig_ManNodeNum( pWin->pWin );
+    Dar_LibStopThread();
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs rewriting of the AIG by windows in several threads.]
+
+  Description [The nodes are divided into windows of consecutive nodes in
+  the DFS order.  Each window is rewritten by Dar_ManRewrite() in its own
+  manager with the same parameters, while the boundary of the window is
+  frozen.  The rewritten windows are stitched together in the topological
+  order, which also restores the sharing across the window boundaries.
+  When the levels are preserved, they are preserved within each window,
+  whose inputs start at level 0.  Rewriting cannot use the logic on the
+  other side of the window boundary, so the result is usually a few
+  percent larger than that of the serial rewriting.  Returns the new AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManRewritePar( Aig_Man_t * p, Dar_RwrPar_t * pPars )
+{
+    Aig_Man_t * pNew;
+    Dar_ParWin_t * pWins;
+    Vec_Ptr_t * vNodes, * vWins, * vWinNodes;
+    Aig_Obj_t * pObj, * pFanin;
+    int i, k, nWins, nWinSize, nNodesBeg, nNodesWin = 0;
+    abctime clk, clkTotal = Abc_Clock(), clkExtract, clkRewrite;
+    assert( pPars->nProcs > 1 );
+    nNodesBeg = Aig_ManNodeNum( p );
+    // prepare the library before it is copied by the threads
+    Dar_LibPrepare( pPars->nSubgMax );
+    // divide the nodes into windows
+    clk = Abc_Clock();
+    vNodes   = Aig_ManDfs( p, 1 );
+    nWinSize = pPars->nWinSize ? pPars->nWinSize : Abc_MaxInt( 1000, Vec_PtrSize(vNodes) / (4 * pPars->nProcs) + 1 );
+    nWins    = Abc_MaxInt( 1, (Vec_PtrSize(vNodes) + nWinSize - 1) / nWinSize );
+    // mark the nodes with fanouts outside of their windows
+    Aig_ManCleanData( p );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        pObj->pData = (void *)(ABC_PTRINT_T)(i / nWinSize);
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        pFanin = Aig_ObjFanin0(pObj);
+        if ( Aig_ObjIsNode(pFanin) && pFanin->pData != pObj->pData )
+            pFanin->fMarkA = 1;
+        pFanin = Aig_ObjFanin1(pObj);
+        if ( Aig_ObjIsNode(pFanin) && pFanin->pData != pObj->pData )
+            pFanin->fMarkA = 1;
+    }
+    Aig_ManForEachCo( p, pObj, i )
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) )
+            Aig_ObjFanin0(pObj)->fMarkA = 1;
+    // extract the windows
+    pWins = ABC_CALLOC( Dar_ParWin_t, nWins );
+    vWins = Vec_PtrAlloc( nWins );
+    for ( i = 0; i < nWins; i++ )
+    {
+        Dar_ManWindowExtract( p, pWins + i, vNodes, i * nWinSize, Abc_MinInt((i+1) * nWinSize, Vec_PtrSize(vNodes)) );
+        pWins[i].Pars = *pPars;
+        pWins[i].Pars.fVerbose = 0;
+        pWins[i].Pars.fVeryVerbose = 0;
+        Vec_PtrPush( vWins, pWins + i );
+    }
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        pObj->fMarkA = 0;
+    clkExtract = Abc_Clock() - clk;
+    // rewrite the windows (the calling thread only dispatches the jobs)
+    clk = Abc_Clock();
+    Util_ProcessThreads( Dar_ManRewriteWindow, vWins, pPars->nProcs + 1, 0, 0 );
+    clkRewrite = Abc_Clock() - clk;
+    // stitch the windows
+    pNew = Aig_ManStart( Aig_ManObjNumMax(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pNew->nAsserts = p->nAsserts;
+    pNew->nConstrs = p->nConstrs;
+    pNew->nBarBufs = p->nBarBufs;
+    if ( p->vFlopNums )
+        pNew->vFlopNums = Vec_IntDup( p->vFlopNums );
+    Aig_ManCleanData( p );
+    Aig_ManConst1(p)->pData = Aig_ManConst1(pNew);
+    Aig_ManForEachCi( p, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    for ( i = 0; i < nWins; i++ )
+    {
+        Aig_Man_t * pWin = pWins[i].pWin;
+        nNodesWin += pWins[i].nNodesEnd;
+        Aig_ManCleanData( pWin );
+        Aig_ManConst1(pWin)->pData = Aig_ManConst1(pNew);
+        Aig_ManForEachCi( pWin, pObj, k )
+            pObj->pData = ((Aig_Obj_t *)Vec_PtrEntry(pWins[i].vIns, k))->pData;
+        vWinNodes = Aig_ManDfs( pWin, 1 );
+        Vec_PtrForEachEntry( Aig_Obj_t *, vWinNodes, pObj, k )
+            pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        Vec_PtrFree( vWinNodes );
+        Aig_ManForEachCo( pWin, pObj, k )
+            ((Aig_Obj_t *)Vec_PtrEntry(pWins[i].vOuts, k))->pData = Aig_ObjChild0Copy(pObj);
+        Aig_ManStop( pWin );
+        Vec_PtrFree( pWins[i].vIns );
+        Vec_PtrFree( pWins[i].vOuts );
+    }
+    Aig_ManForEachCo( p, pObj, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(pObj) );
+    Aig_ManSetRegNum( pNew, Aig_ManRegNum(p) );
+    Aig_ManCleanup( pNew );
+    if ( pPars->fVerbose )
+    {
+        printf( "Windows = %d. Window size = %d. Threads = %d.  ", nWins, nWinSize, pPars->nProcs );
+        printf( "Nodes: Before = %d. Windows = %d. After = %d. Gain = %d (%.2f %%).\n",
+            nNodesBeg, nNodesWin, Aig_ManNodeNum(pNew), nNodesBeg - Aig_ManNodeNum(pNew),
+            nNodesBeg ? 100.0 * (nNodesBeg - Aig_ManNodeNum(pNew)) / nNodesBeg : 0.0 );
+        ABC_PRT( "Extract ", clkExtract );
+        ABC_PRT( "Rewrite ", clkRewrite );
+        ABC_PRT( "TOTAL   ", Abc_Clock() - clkTotal );
+    }
+    Vec_PtrFree( vWins );
+    Vec_PtrFree( vNodes );
+    ABC_FREE( pWins );
+    if ( !Aig_ManCheck( pNew ) )
+        printf( "Dar_ManRewritePar: The network check has failed.\n" );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -59,6 +59,7 @@ struct Dch_Man_t_
     // equivalence classes
     Dch_Cla_t *      ppClasses;      // equivalence classes of nodes
     Aig_Obj_t **     pReprsProved;   // equivalences proved
+    Aig_Obj_t **     pReprsPre;      // equivalences proved by the threads in the current level
     // SAT solving
     sat_solver *     pSat;           // recyclable SAT solver
     int              nSatVars;       // the counter of SAT variables
@@ -78,6 +79,9 @@ struct Dch_Man_t_
     int              nSatFailsReal;  // the number of timeouts
     int              nSatCallsUnsat; // the number of unsat SAT calls
     int              nSatCallsSat;   // the number of sat SAT calls
+    int              nParCalls;      // the number of SAT calls in the threads
+    int              nParProved;     // the number of pairs proved in the threads
+    int              nParUsed;       // the number of pairs proved in the threads used by sweeping
     // choice node statistics
     int              nLits;          // the number of lits in the cand equiv classes
     int              nReprs;         // the number of proved equivalent pairs
@@ -85,6 +89,7 @@ struct Dch_Man_t_
     int              nChoices;       // the number of final choice nodes
     // runtime stats
     abctime          timeSimInit;    // simulation and class computation
+    abctime          timePar;        // proving in the threads
     abctime          timeSimSat;     // simulation of the counter-examples
     abctime          timeSat;        // solving SAT
     abctime          timeSatSat;     // sat
@@ -104,6 +109,8 @@ static inline void Dch_ObjSetSatNum( Dch_Man_t * p, Aig_Obj_t * pObj, int Num )
 
 static inline Aig_Obj_t * Dch_ObjFraig( Aig_Obj_t * pObj )                       { return (Aig_Obj_t *)pObj->pData;  }
 static inline void        Dch_ObjSetFraig( Aig_Obj_t * pObj, Aig_Obj_t * pNode ) { pObj->pData = pNode; }
+static inline Aig_Obj_t * Dch_ObjChild0Fra( Aig_Obj_t * pObj ) { assert( !Aig_IsComplement(pObj) ); return Aig_ObjFanin0(pObj)? Aig_NotCond(Dch_ObjFraig(Aig_ObjFanin0(pObj)), Aig_ObjFaninC0(pObj)) : NULL;  }
+static inline Aig_Obj_t * Dch_ObjChild1Fra( Aig_Obj_t * pObj ) { assert( !Aig_IsComplement(pObj) ); return Aig_ObjFanin1(pObj)? Aig_NotCond(Dch_ObjFraig(Aig_ObjFanin1(pObj)), Aig_ObjFaninC1(pObj)) : NULL;  }
 
 static inline int  Dch_ObjIsConst1Cand( Aig_Man_t * pAig, Aig_Obj_t * pObj ) 
 {
@@ -146,6 +153,8 @@ extern void          Dch_CnfNodeAddToSolver( Dch_Man_t * p, Aig_Obj_t * pObj );
 extern Dch_Man_t *   Dch_ManCreate( Aig_Man_t * pAig, Dch_Pars_t * pPars );
 extern void          Dch_ManStop( Dch_Man_t * p );
 extern void          Dch_ManSatSolverRecycle( Dch_Man_t * p );
+/*=== dchPar.c ===================================================*/
+extern void          Dch_ManSweepPar( Dch_Man_t * p );
 /*=== dchSat.c ===================================================*/
 extern int           Dch_NodesAreEquiv( Dch_Man_t * p, Aig_Obj_t * pObj1, Aig_Obj_t * pObj2 );
 /*=== dchSim.c ===================================================*/
@@ -154,6 +163,7 @@ extern Dch_Cla_t *   Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, i
 extern void          Dch_ManResimulateCex( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pRepr );
 extern void          Dch_ManResimulateCex2( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pRepr );
 /*=== dchSweep.c ===================================================*/
+extern void          Dch_ManSweepNode( Dch_Man_t * p, Aig_Obj_t * pObj );
 extern void          Dch_ManSweep( Dch_Man_t * p );
 
 
@@ -89,11 +89,16 @@ void Dch_ManPrintStats( Dch_Man_t * p )
     Abc_Print( 1, "SAT calls : All = %6d. Unsat = %6d. Sat = %6d. Fail = %6d.\n", 
         p->nSatCalls, p->nSatCalls-p->nSatCallsSat-p->nSatFailsReal, 
         p->nSatCallsSat, p->nSatFailsReal );
+    if ( p->pPars->nProcs > 1 )
+    Abc_Print( 1, "Threads   : Procs = %6d. Calls = %6d. Proved = %6d. Used = %6d.\n", 
+        p->pPars->nProcs, p->nParCalls, p->nParProved, p->nParUsed );
     Abc_Print( 1, "Choices   : Lits = %6d. Reprs = %5d. Equivs = %5d. Choices = %5d.\n", 
         p->nLits, p->nReprs, p->nEquivs, p->nChoices );
     Abc_Print( 1, "Choicing runtime statistics:\n" );
-    p->timeOther = p->timeTotal-p->timeSimInit-p->timeSimSat-p->timeSat-p->timeChoice;
+    p->timeOther = p->timeTotal-p->timeSimInit-p->timeSimSat-p->timeSat-p->timeChoice-p->timePar;
     Abc_PrintTimeP( 1, "Sim init   ", p->timeSimInit,  p->timeTotal );
+    if ( p->pPars->nProcs > 1 )
+    Abc_PrintTimeP( 1, "Threads    ", p->timePar,      p->timeTotal );
     Abc_PrintTimeP( 1, "Sim SAT    ", p->timeSimSat,   p->timeTotal );
     Abc_PrintTimeP( 1, "SAT solving", p->timeSat,      p->timeTotal );
     Abc_PrintTimeP( 1, "  sat      ", p->timeSatSat,   p->timeTotal );
@@ -135,6 +140,7 @@ void Dch_ManStop( Dch_Man_t * p )
     Vec_PtrFree( p->vSimRoots );
     Vec_PtrFree( p->vSimClasses );
     ABC_FREE( p->pReprsProved );
+    ABC_FREE( p->pReprsPre );
     ABC_FREE( p->pSatVars );
     ABC_FREE( p );
 }
@@ -0,0 +1,254 @@
+/**CFile****************************************************************
+
+  FileName    [dchPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Choice computation for tech-mapping.]
+
+  Synopsis    [Proving candidate equivalences in several threads.]
+
+  Author      [agent]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "dchInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Dch_Par_t_ Dch_Par_t;
+struct Dch_Par_t_
+{
+    Dch_Man_t *      pMan;           // the choicing manager
+    Dch_Man_t **     pWorkers;       // the SAT solving managers of the threads
+    Vec_Vec_t *      vLevels;        // the nodes of the total AIG by level
+    Vec_Ptr_t *      vNodes;         // the nodes of the level proved by the threads
+    Vec_Ptr_t *      vPairs;         // the candidate pairs (representative, node)
+    int              nProcs;         // the number of threads
+    int              iLevel;         // the next level to sweep
+    abctime          clkRound;       // the start of the round
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts/stops the SAT solving manager of one thread.]
+
+  Description [The worker shares the parameters and the AIGs with the
+  choicing manager, while the solver, the CNF variables and the temporary
+  arrays are private.  The fraiged AIG is not modified while the threads
+  are running.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Dch_Man_t * Dch_ManWorkerStart( Dch_Man_t * p )
+{
+    Dch_Man_t * pWorker;
+    pWorker = ABC_CALLOC( Dch_Man_t, 1 );
+    pWorker->pPars      = p->pPars;
+    pWorker->pAigTotal  = p->pAigTotal;
+    pWorker->pAigFraig  = p->pAigFraig;
+    pWorker->nSatVars   = 1;
+    pWorker->pSatVars   = ABC_CALLOC( int, Aig_ManObjNumMax(p->pAigTotal) );
+    pWorker->vUsedNodes = Vec_PtrAlloc( 1000 );
+    pWorker->vFanins    = Vec_PtrAlloc( 100 );
+    return pWorker;
+}
+static void Dch_ManWorkerStop( Dch_Man_t * pWorker )
+{
+    if ( pWorker->pSat )
+        sat_solver_delete( pWorker->pSat );
+    Vec_PtrFree( pWorker->vUsedNodes );
+    Vec_PtrFree( pWorker->vFanins );
+    ABC_FREE( pWorker->pSatVars );
+    ABC_FREE( pWorker );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sweeps the nodes of one level in the calling thread.]
+
+  Description [The candidate pairs proved by the threads are not given
+  to the solver again, unless the representative has changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dch_ManSweepParLevel( Dch_Par_t * p, Vec_Ptr_t * vNodes )
+{
+    Aig_Obj_t * pObj;
+    int i;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        if ( Dch_ObjFraig(pObj) != NULL )
+            Dch_ManSweepNode( p->pMan, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the next round of the threads.]
+
+  Description [Sweeps the level proved in the previous round.  Then
+  derives the fraiged nodes of the next level and collects the candidate
+  pairs, whose fraiged nodes are different.  The levels with fewer pairs
+  than threads are swept in the calling thread.  Returns 0 when all the
+  levels have been swept.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dch_ManSweepParRound( void * pArg )
+{
+    Dch_Par_t * p = (Dch_Par_t *)pArg;
+    Dch_Man_t * pMan = p->pMan;
+    Vec_Ptr_t * vNodes;
+    Aig_Obj_t * pObj, * pRepr, * pObjNew;
+    int i;
+    if ( p->vNodes )
+    {
+        pMan->timePar += Abc_Clock() - p->clkRound;
+        Vec_PtrForEachEntryDouble( Aig_Obj_t *, Aig_Obj_t *, p->vPairs, pRepr, pObj, i )
+            pMan->nParProved += (pMan->pReprsPre[pObj->Id] == pRepr);
+        Dch_ManSweepParLevel( p, p->vNodes );
+        p->vNodes = NULL;
+    }
+    while ( p->iLevel < Vec_VecSize(p->vLevels) )
+    {
+        vNodes = Vec_VecEntry( p->vLevels, p->iLevel++ );
+        // the fanins of the nodes are on the lower levels
+        Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        {
+            if ( Dch_ObjFraig(Aig_ObjFanin0(pObj)) == NULL ||
+                 Dch_ObjFraig(Aig_ObjFanin1(pObj)) == NULL )
+                continue;
+            pObjNew = Aig_And( pMan->pAigFraig, Dch_ObjChild0Fra(pObj), Dch_ObjChild1Fra(pObj) );
+            Dch_ObjSetFraig( pObj, pObjNew );
+        }
+        Vec_PtrClear( p->vPairs );
+        Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        {
+            pRepr = Aig_ObjRepr( pMan->pAigTotal, pObj );
+            if ( pRepr == NULL || Dch_ObjFraig(pObj) == NULL || Dch_ObjFraig(pRepr) == NULL )
+                continue;
+            if ( Aig_Regular(Dch_ObjFraig(pObj)) == Aig_Regular(Dch_ObjFraig(pRepr)) )
+                continue;
+            Vec_PtrPush( p->vPairs, pRepr );
+            Vec_PtrPush( p->vPairs, pObj );
+        }
+        if ( Vec_PtrSize(p->vPairs) / 2 >= p->nProcs )
+        {
+            p->vNodes = vNodes;
+            p->clkRound = Abc_Clock();
+            return 1;
+        }
+        Dch_ManSweepParLevel( p, vNodes );
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves the candidate pairs assigned to one thread.]
+
+  Description [Each thread proves a range of consecutive pairs, which
+  tend to share the logic cones.  The thread writes only the entries of
+  its own nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dch_ManSweepParThread( void * pArg, int iThread )
+{
+    Dch_Par_t * p = (Dch_Par_t *)pArg;
+    Dch_Man_t * pWorker = p->pWorkers[iThread];
+    Aig_Obj_t * pRepr, * pObj;
+    int i, nPairs = Vec_PtrSize(p->vPairs) / 2;
+    int iBeg = nPairs * iThread / p->nProcs;
+    int iEnd = nPairs * (iThread + 1) / p->nProcs;
+    for ( i = iBeg; i < iEnd; i++ )
+    {
+        pRepr = (Aig_Obj_t *)Vec_PtrEntry( p->vPairs, 2*i );
+        pObj  = (Aig_Obj_t *)Vec_PtrEntry( p->vPairs, 2*i+1 );
+        if ( Dch_NodesAreEquiv( pWorker, Aig_Regular(Dch_ObjFraig(pRepr)), Aig_Regular(Dch_ObjFraig(pObj)) ) == 1 )
+            p->pMan->pReprsPre[pObj->Id] = pRepr;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs fraiging for the internal nodes in several threads.]
+
+  Description [The nodes are swept level by level.  The nodes of one
+  level do not depend on each other, so their fraiged nodes are derived
+  first, and the candidate pairs of the level are proved by the threads,
+  each with its own SAT solver and CNF of the fraiged AIG.  After that,
+  the nodes of the level are swept in the calling thread in the order of
+  their IDs, as in Dch_ManSweep().  The proved pairs are merged without
+  calling the solver, while the disproved pairs and the pairs, whose
+  representative has been changed by the refinement, are solved again
+  to get the counter-examples.  Because the refinement and the merging
+  are done by one thread, the result does not depend on the scheduling.
+  However, it differs from the result of Dch_ManSweep(), because the nodes
+  are swept by levels rather than by IDs, and solving the pairs before
+  the refinement roughly doubles the total SAT work.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSweepPar( Dch_Man_t * p )
+{
+    Dch_Par_t Par, * pPar = &Par;
+    Aig_Obj_t * pObj;
+    int i, LevelMax = 0;
+    assert( p->pPars->nProcs > 1 );
+    memset( pPar, 0, sizeof(Dch_Par_t) );
+    pPar->pMan   = p;
+    pPar->nProcs = p->pPars->nProcs;
+    pPar->vPairs = Vec_PtrAlloc( 1000 );
+    Aig_ManForEachNode( p->pAigTotal, pObj, i )
+        LevelMax = Abc_MaxInt( LevelMax, Aig_ObjLevel(pObj) );
+    pPar->vLevels = Vec_VecStart( LevelMax + 1 );
+    Aig_ManForEachNode( p->pAigTotal, pObj, i )
+        Vec_VecPush( pPar->vLevels, Aig_ObjLevel(pObj), pObj );
+    p->pReprsPre = ABC_CALLOC( Aig_Obj_t *, Aig_ManObjNumMax(p->pAigTotal) );
+    pPar->pWorkers = ABC_ALLOC( Dch_Man_t *, pPar->nProcs );
+    for ( i = 0; i < pPar->nProcs; i++ )
+        pPar->pWorkers[i] = Dch_ManWorkerStart( p );
+    Util_ProcessThreadsRounds( Dch_ManSweepParRound, Dch_ManSweepParThread, pPar, pPar->nProcs );
+    for ( i = 0; i < pPar->nProcs; i++ )
+    {
+        p->nParCalls += pPar->pWorkers[i]->nSatCalls;
+        Dch_ManWorkerStop( pPar->pWorkers[i] );
+    }
+    ABC_FREE( pPar->pWorkers );
+    Vec_VecFree( pPar->vLevels );
+    Vec_PtrFree( pPar->vPairs );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
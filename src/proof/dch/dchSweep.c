@@ -28,8 +28,6 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static inline Aig_Obj_t * Dch_ObjChild0Fra( Aig_Obj_t * pObj ) { assert( !Aig_IsComplement(pObj) ); return Aig_ObjFanin0(pObj)? Aig_NotCond(Dch_ObjFraig(Aig_ObjFanin0(pObj)), Aig_ObjFaninC0(pObj)) : NULL;  }
-static inline Aig_Obj_t * Dch_ObjChild1Fra( Aig_Obj_t * pObj ) { assert( !Aig_IsComplement(pObj) ); return Aig_ObjFanin1(pObj)? Aig_NotCond(Dch_ObjFraig(Aig_ObjFanin1(pObj)), Aig_ObjFaninC1(pObj)) : NULL;  }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -70,7 +68,14 @@ void Dch_ManSweepNode( Dch_Man_t * p, Aig_Obj_t * pObj )
         return;
     }
     assert( Aig_Regular(pObjFraig) != Aig_ManConst1(p->pAigFraig) );
-    RetValue = Dch_NodesAreEquiv( p, Aig_Regular(pObjReprFraig), Aig_Regular(pObjFraig) );
+    // use the equivalence proved by the threads if the representative is the same
+    if ( p->pReprsPre && p->pReprsPre[pObj->Id] == pObjRepr )
+    {
+        p->nParUsed++;
+        RetValue = 1;
+    }
+    else
+        RetValue = Dch_NodesAreEquiv( p, Aig_Regular(pObjReprFraig), Aig_Regular(pObjFraig) );
     if ( RetValue == -1 ) // timed out
     {
         Dch_ObjSetFraig( pObj, NULL );
@@ -115,20 +120,25 @@ void Dch_ManSweep( Dch_Man_t * p )
     Aig_ManForEachCi( p->pAigTotal, pObj, i )
         pObj->pData = Aig_ObjCreateCi( p->pAigFraig );
     // sweep internal nodes
-    pProgress = Bar_ProgressStart( stdout, Aig_ManObjNumMax(p->pAigTotal) );
-    Aig_ManForEachNode( p->pAigTotal, pObj, i )
+    if ( p->pPars->nProcs > 1 )
+        Dch_ManSweepPar( p );
+    else
     {
-        Bar_ProgressUpdate( pProgress, i, NULL );
-        if ( Dch_ObjFraig(Aig_ObjFanin0(pObj)) == NULL || 
-             Dch_ObjFraig(Aig_ObjFanin1(pObj)) == NULL )
-            continue;
-        pObjNew = Aig_And( p->pAigFraig, Dch_ObjChild0Fra(pObj), Dch_ObjChild1Fra(pObj) );
-        if ( pObjNew == NULL )
-            continue;
-        Dch_ObjSetFraig( pObj, pObjNew );
-        Dch_ManSweepNode( p, pObj );
+        pProgress = Bar_ProgressStart( stdout, Aig_ManObjNumMax(p->pAigTotal) );
+        Aig_ManForEachNode( p->pAigTotal, pObj, i )
+        {
+            Bar_ProgressUpdate( pProgress, i, NULL );
+            if ( Dch_ObjFraig(Aig_ObjFanin0(pObj)) == NULL || 
+                 Dch_ObjFraig(Aig_ObjFanin1(pObj)) == NULL )
+                continue;
+            pObjNew = Aig_And( p->pAigFraig, Dch_ObjChild0Fra(pObj), Dch_ObjChild1Fra(pObj) );
+            if ( pObjNew == NULL )
+                continue;
+            Dch_ObjSetFraig( pObj, pObjNew );
+            Dch_ManSweepNode( p, pObj );
+        }
+        Bar_ProgressStop( pProgress );
     }
-    Bar_ProgressStop( pProgress );
     // update the representatives of the nodes (makes classes invalid)
     ABC_FREE( p->pAigTotal->pReprs );
     p->pAigTotal->pReprs = p->pReprsProved;
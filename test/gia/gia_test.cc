@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 
+#include <atomic>
+
 #include "aig/gia/gia.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -51,4 +53,183 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, ConcurrentRehashMatchesSerial) {
+  Gia_Man_t* aig_manager = Gia_ManStart(10000);
+  Vec_Int_t* literals = Vec_IntAlloc(1000);
+  Gia_ManRandom(1);
+  for (int i = 0; i < 16; i++)
+    Vec_IntPush(literals, Gia_ManAppendCi(aig_manager));
+  // without hashing, the same pairs of fanins create duplicate nodes
+  for (int i = 0; i < 3000; i++) {
+    int lit0 = Vec_IntEntry(literals, Gia_ManRandom(0) % Vec_IntSize(literals)) ^ (Gia_ManRandom(0) & 1);
+    int lit1 = Vec_IntEntry(literals, Gia_ManRandom(0) % Vec_IntSize(literals)) ^ (Gia_ManRandom(0) & 1);
+    if (Abc_Lit2Var(lit0) == Abc_Lit2Var(lit1))
+      continue;
+    Vec_IntPush(literals, Gia_ManAppendAnd(aig_manager, Abc_MinInt(lit0, lit1), Abc_MaxInt(lit0, lit1)));
+  }
+  for (int i = Vec_IntSize(literals) - 64; i < Vec_IntSize(literals); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(literals, i));
+  Gia_Man_t* serial = Gia_ManRehash(aig_manager, 0);
+  Gia_Man_t* concurrent = Gia_ManRehashPar(aig_manager, 4, 0);
+
+  Vec_Wrd_t* stimulus = Vec_WrdAlloc(16);
+  for (int i = 0; i < 16; i++)
+    Vec_WrdPush(stimulus, ((word)Gia_ManRandom(0) << 32) | Gia_ManRandom(0));
+  Vec_Wrd_t* serial_output = Gia_ManSimPatSimOut(serial, stimulus, /*fouts*/1);
+  Vec_Wrd_t* concurrent_output = Gia_ManSimPatSimOut(concurrent, stimulus, /*fouts*/1);
+
+  EXPECT_EQ(Gia_ManAndNum(concurrent), Gia_ManAndNum(serial));
+  EXPECT_EQ(Gia_ManCoNum(concurrent), 64);
+  // the result is the same AIG as the serial one for any number of threads
+  for (int nThreads : {2, 3, 4, 8, 64}) {
+    Gia_Man_t* other = Gia_ManRehashPar(aig_manager, nThreads, 0);
+    ASSERT_EQ(Gia_ManObjNum(other), Gia_ManObjNum(serial)) << nThreads << " threads";
+    for (int i = 0; i < Gia_ManObjNum(serial); i++) {
+      Gia_Obj_t* pObj0 = Gia_ManObj(serial, i);
+      Gia_Obj_t* pObj1 = Gia_ManObj(other, i);
+      ASSERT_EQ(pObj1->fTerm, pObj0->fTerm) << "object " << i << ", " << nThreads << " threads";
+      EXPECT_EQ(pObj1->iDiff0, pObj0->iDiff0) << "object " << i << ", " << nThreads << " threads";
+      EXPECT_EQ(pObj1->fCompl0, pObj0->fCompl0) << "object " << i << ", " << nThreads << " threads";
+      EXPECT_EQ(pObj1->iDiff1, pObj0->iDiff1) << "object " << i << ", " << nThreads << " threads";
+      EXPECT_EQ(pObj1->fCompl1, pObj0->fCompl1) << "object " << i << ", " << nThreads << " threads";
+    }
+    Gia_ManStop(other);
+  }
+  for (int i = 0; i < 64; i++)
+    EXPECT_EQ(Vec_WrdEntry(concurrent_output, i), Vec_WrdEntry(serial_output, i));
+  Vec_WrdFree(serial_output);
+  Vec_WrdFree(concurrent_output);
+  Vec_WrdFree(stimulus);
+  Vec_IntFree(literals);
+  Gia_ManStop(serial);
+  Gia_ManStop(concurrent);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ConcurrentHashReportsOverflowAndTransfersDeepChains) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  // one thread with no nodes requested still gets one chunk of slack
+  Gia_HashPar_t* hash = Gia_HashParStart(aig_manager, 0, 1);
+  int literal = input1, overflow = 0;
+  for (int i = 0; i < 100000 && !overflow; i++) {
+    literal = Gia_HashParAnd(hash, 0, literal, Abc_LitNotCond(input2, i & 1));
+    overflow = (literal == -1);
+  }
+  EXPECT_TRUE(overflow);
+  Gia_HashParStop(hash);
+
+  // a chain much deeper than the recursion would handle comfortably
+  hash = Gia_HashParStart(aig_manager, 200000, 1);
+  literal = input1;
+  for (int i = 0; i < 200000; i++)
+    literal = Gia_HashParAnd(hash, 0, literal, Abc_LitNotCond(input2, i & 1));
+  ASSERT_GE(literal, 0);
+  Vec_Int_t* literals = Vec_IntAlloc(1);
+  Vec_IntPush(literals, literal);
+  Gia_HashParTransfer(hash, literals);
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 200000);
+  EXPECT_EQ(Abc_Lit2Var(Vec_IntEntry(literals, 0)), Gia_ManObjNum(aig_manager) - 1);
+  Vec_IntFree(literals);
+  Gia_HashParStop(hash);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CompressedAigerRoundTrip) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100000);
+  Vec_Int_t* literals = Vec_IntAlloc(50000);
+  Gia_ManRandom(1);
+  Gia_ManHashStart(aig_manager);
+  for (int i = 0; i < 64; i++)
+    Vec_IntPush(literals, Gia_ManAppendCi(aig_manager));
+  // large enough to flush the output buffer of the writer several times
+  for (int i = 0; i < 50000; i++) {
+    int lit0 = Vec_IntEntry(literals, Gia_ManRandom(0) % Vec_IntSize(literals)) ^ (Gia_ManRandom(0) & 1);
+    int lit1 = Vec_IntEntry(literals, Gia_ManRandom(0) % Vec_IntSize(literals)) ^ (Gia_ManRandom(0) & 1);
+    Vec_IntPush(literals, Gia_ManHashAnd(aig_manager, lit0, lit1));
+  }
+  for (int i = Vec_IntSize(literals) - 64; i < Vec_IntSize(literals); i++)
+    Gia_ManAppendCo(aig_manager, Vec_IntEntry(literals, i));
+  Gia_ManHashStop(aig_manager);
+  Gia_Man_t* original = Gia_ManCleanup(aig_manager);
+
+  Vec_Wrd_t* stimulus = Vec_WrdAlloc(64);
+  for (int i = 0; i < 64; i++)
+    Vec_WrdPush(stimulus, ((word)Gia_ManRandom(0) << 32) | Gia_ManRandom(0));
+  Vec_Wrd_t* original_output = Gia_ManSimPatSimOut(original, stimulus, /*fouts*/1);
+  const char* file_names[3] = {"gia_test_round_trip.aig", "gia_test_round_trip.aig.gz", "gia_test_round_trip.aig.bz2"};
+  for (int f = 0; f < 3; f++) {
+    for (int compact = 0; compact < 2; compact++) {
+      Gia_AigerWrite(original, (char*)file_names[f], 0, compact, 0);
+      Gia_Man_t* read = Gia_AigerRead((char*)file_names[f], 0, 1, 0);
+      ASSERT_TRUE(read != nullptr);
+      EXPECT_EQ(Gia_ManAndNum(read), Gia_ManAndNum(original));
+      Vec_Wrd_t* read_output = Gia_ManSimPatSimOut(read, stimulus, /*fouts*/1);
+      for (int i = 0; i < 64; i++)
+        EXPECT_EQ(Vec_WrdEntry(read_output, i), Vec_WrdEntry(original_output, i));
+      Vec_WrdFree(read_output);
+      Gia_ManStop(read);
+    }
+    remove(file_names[f]);
+  }
+  Vec_WrdFree(original_output);
+  Vec_WrdFree(stimulus);
+  Vec_IntFree(literals);
+  Gia_ManStop(original);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, AigerReadAcceptsFilesOfAnySize) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  int lit0 = Gia_ManAppendCi(aig_manager);
+  int lit1 = Gia_ManAppendCi(aig_manager);
+  Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, lit0, Abc_LitNot(lit1)));
+  Gia_AigerWrite(aig_manager, (char*)"gia_test_size.aig", 0, 0, 0);
+  FILE* file = fopen("gia_test_size.aig", "rb");
+  ASSERT_TRUE(file != nullptr);
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fclose(file);
+  ASSERT_LT(size, 4000);
+  // the comment section is padded to end the file just before, on and after a page boundary
+  for (long target = 4095; target <= 4097; target++) {
+    file = fopen("gia_test_size.aig", "ab");
+    ASSERT_TRUE(file != nullptr);
+    while (ftell(file) < target)
+      fputc('x', file);
+    fclose(file);
+    Gia_Man_t* read = Gia_AigerRead((char*)"gia_test_size.aig", 0, 1, 0);
+    ASSERT_TRUE(read != nullptr) << target;
+    EXPECT_EQ(Gia_ManAndNum(read), 1);
+    EXPECT_EQ(Gia_ManCoNum(read), 1);
+    Gia_ManStop(read);
+  }
+  EXPECT_TRUE(Gia_AigerRead((char*)"gia_test_missing.aig", 0, 1, 0) == nullptr);
+  remove("gia_test_size.aig");
+  Gia_ManStop(aig_manager);
+}
+
+struct ThreadRoundsData {
+  int nRounds = 0;
+  std::atomic<int> nCalls[150];
+};
+
+static int ThreadRoundsNext(void* pArg) {
+  return ((ThreadRoundsData*)pArg)->nRounds++ < 3;
+}
+
+static void ThreadRoundsCall(void* pArg, int iThread) {
+  ((ThreadRoundsData*)pArg)->nCalls[iThread]++;
+}
+
+TEST(GiaTest, ThreadRoundsCallEveryThreadNumberAboveTheLimit) {
+  ThreadRoundsData Data;
+  for (int i = 0; i < 150; i++)
+    Data.nCalls[i] = 0;
+  Util_ProcessThreadsRounds(ThreadRoundsNext, ThreadRoundsCall, &Data, 150);
+  for (int i = 0; i < 150; i++)
+    EXPECT_EQ(Data.nCalls[i], 3) << "thread " << i;
+}
+
 ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,169 @@
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "base/abc/abc.h"
+#include "base/io/ioAbc.h"
+#include "base/main/main.h"
+
+ABC_NAMESPACE_IMPL_START
+
+static const char* kGenlib =
+    "GATE ZERO  0 O=CONST0;\n"
+    "GATE ONE   0 O=CONST1;\n"
+    "GATE INV   1 O=!a;      PIN * INV    1 999 1 0 1 0\n"
+    "GATE BUF   1 O=a;       PIN * NONINV 1 999 1 0 1 0\n"
+    "GATE NAND2 2 O=!(a*b);  PIN * INV    1 999 1 0 1 0\n"
+    "GATE NOR2  2 O=!(a+b);  PIN * INV    1 999 1 0 1 0\n";
+
+static const char* kBlif =
+    ".model snap\n"
+    ".inputs a b c d\n"
+    ".outputs x y\n"
+    ".latch n1 q 1\n"
+    ".names a b n1\n11 1\n"
+    ".names q c d n2\n1-- 1\n-11 1\n"
+    ".names n2 a x\n10 1\n01 1\n"
+    ".names n1 n2 y\n00 1\n"
+    ".end\n";
+
+static void WriteFile(const char* pFileName, const std::string& Contents) {
+  std::ofstream File(pFileName, std::ios::binary);
+  File << Contents;
+}
+
+static std::string ReadFile(const char* pFileName) {
+  std::ifstream File(pFileName, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+}
+
+class IoSnapTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Abc_Start();
+    WriteFile("snap_test.genlib", kGenlib);
+    WriteFile("snap_test.blif", kBlif);
+    Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, "read_library snap_test.genlib"), 0);
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, "read_blif snap_test.blif; strash; map"), 0);
+    pNtk = Abc_FrameReadNtk(pAbc);
+    ASSERT_TRUE(pNtk != nullptr && Abc_NtkHasMapping(pNtk));
+  }
+  void TearDown() override {
+    remove("snap_test.genlib");
+    remove("snap_test.blif");
+    remove("snap_test.snap");
+    remove("snap_bad.snap");
+    remove("snap_test.ses");
+    remove("snap_bad.ses");
+    Abc_Stop();
+  }
+  Abc_Ntk_t* pNtk = nullptr;
+};
+
+TEST_F(IoSnapTest, RoundTripPreservesMappedNetwork) {
+  ASSERT_EQ(Io_WriteSnap(pNtk, (char*)"snap_test.snap"), 1);
+  Abc_Ntk_t* pNtkNew = Io_ReadSnap((char*)"snap_test.snap", 1);
+  ASSERT_TRUE(pNtkNew != nullptr);
+
+  EXPECT_EQ(Abc_NtkPiNum(pNtkNew), Abc_NtkPiNum(pNtk));
+  EXPECT_EQ(Abc_NtkPoNum(pNtkNew), Abc_NtkPoNum(pNtk));
+  EXPECT_EQ(Abc_NtkLatchNum(pNtkNew), Abc_NtkLatchNum(pNtk));
+  EXPECT_EQ(Abc_NtkNodeNum(pNtkNew), Abc_NtkNodeNum(pNtk));
+  EXPECT_DOUBLE_EQ(Abc_NtkGetMappedArea(pNtkNew), Abc_NtkGetMappedArea(pNtk));
+  EXPECT_EQ(Abc_LatchInit(Abc_NtkBox(pNtkNew, 0)), Abc_LatchInit(Abc_NtkBox(pNtk, 0)));
+  Abc_Obj_t* pObj;
+  int i;
+  Abc_NtkForEachPo(pNtk, pObj, i)
+      EXPECT_STREQ(Abc_ObjName(Abc_NtkPo(pNtkNew, i)), Abc_ObjName(pObj));
+
+  // writing the network read back gives the same body
+  ASSERT_EQ(Io_WriteSnap(pNtkNew, (char*)"snap_bad.snap"), 1);
+  std::string First = ReadFile("snap_test.snap");
+  std::string Second = ReadFile("snap_bad.snap");
+  EXPECT_EQ(First.substr(First.find('\n')), Second.substr(Second.find('\n')));
+  Abc_NtkDelete(pNtkNew);
+}
+
+TEST_F(IoSnapTest, RejectsTruncatedAndMalformedFiles) {
+  ASSERT_EQ(Io_WriteSnap(pNtk, (char*)"snap_test.snap"), 1);
+  std::string Contents = ReadFile("snap_test.snap");
+  for (size_t n = 0; n < Contents.size(); n++) {
+    WriteFile("snap_bad.snap", Contents.substr(0, n));
+    EXPECT_TRUE(Io_ReadSnap((char*)"snap_bad.snap", 1) == nullptr) << "prefix of " << n << " bytes";
+  }
+  WriteFile("snap_bad.snap", std::string("#x\nfoo\0lib\0" "999999999\0", 21));
+  EXPECT_TRUE(Io_ReadSnap((char*)"snap_bad.snap", 1) == nullptr);
+  std::string Huge = Contents;
+  size_t Pos = Huge.find(IO_SNAP_MAGIC);
+  ASSERT_NE(Pos, std::string::npos);
+  Huge.replace(Pos, strlen(IO_SNAP_MAGIC), "ABC-SNAQ");
+  WriteFile("snap_bad.snap", Huge);
+  EXPECT_TRUE(Io_ReadSnap((char*)"snap_bad.snap", 1) == nullptr);
+}
+
+// overwrites the data of the section with the given tag, keeping its size
+static bool CorruptSection(std::string& Contents, const std::string& Tag) {
+  size_t Pos = Contents.find(Tag + std::string("\0", 1));
+  if (Pos == std::string::npos)
+    return false;
+  int nSize;
+  Pos += Tag.size() + 1;
+  memcpy(&nSize, Contents.data() + Pos, sizeof(int));
+  Contents.replace(Pos + sizeof(int), nSize, nSize, 'x');
+  return true;
+}
+
+TEST_F(IoSnapTest, SessionLoadRejectsBadFilesWithoutChangingTheFrame) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  // command &get turns the mapped network into an AIG, so it is called before mapping
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, "strash; &get -n; map; save_session snap_test.ses"), 0);
+  int nNodes = Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc));
+  std::string Contents = ReadFile("snap_test.ses");
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, "load_session snap_test.ses"), 0);
+  Abc_Ntk_t* pNtkLoaded = Abc_FrameReadNtk(pAbc);
+  ASSERT_TRUE(pNtkLoaded != nullptr && Abc_NtkHasMapping(pNtkLoaded));
+  EXPECT_EQ(Abc_NtkNodeNum(pNtkLoaded), nNodes);
+  ASSERT_TRUE(Abc_FrameReadGia(pAbc) != nullptr);
+
+  std::vector<std::string> Bad;
+  for (size_t n = 0; n < Contents.size(); n += 7)
+    Bad.push_back(Contents.substr(0, n));
+  for (const char* Tag : {"flags", "genlib", "ntk", "gia"}) {
+    std::string Corrupted = Contents;
+    ASSERT_TRUE(CorruptSection(Corrupted, Tag)) << Tag;
+    Bad.push_back(Corrupted);
+  }
+  // flipping one byte of the embedded AIGER file is caught by the checksum
+  size_t Pos = Contents.find(std::string("gia\0", 4));
+  ASSERT_NE(Pos, std::string::npos);
+  Bad.push_back(Contents);
+  Bad.back()[Contents.find("aig ", Pos) + 4] ^= 1;
+  for (const std::string& File : Bad) {
+    WriteFile("snap_bad.ses", File);
+    EXPECT_NE(Cmd_CommandExecute(pAbc, "load_session snap_bad.ses"), 0);
+    EXPECT_EQ(Abc_FrameReadNtk(pAbc), pNtkLoaded);
+  }
+}
+
+TEST_F(IoSnapTest, SessionSaveFailureKeepsThePreviousFile) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, "save_session snap_test.ses"), 0);
+  std::string Contents = ReadFile("snap_test.ses");
+  ASSERT_FALSE(Contents.empty());
+  // the temporary file cannot be created when its name is taken by a directory
+  ASSERT_EQ(mkdir("snap_test.ses.tmp", 0755), 0);
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, "strash"), 0);
+  EXPECT_NE(Cmd_CommandExecute(pAbc, "save_session snap_test.ses"), 0);
+  rmdir("snap_test.ses.tmp");
+  EXPECT_EQ(ReadFile("snap_test.ses"), Contents);
+}
+
+ABC_NAMESPACE_IMPL_END
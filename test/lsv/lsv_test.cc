@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "base/abc/abc.h"
+#include "base/io/ioAbc.h"
+#include "base/main/main.h"
+#include "ext-lsv/lsvInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+class LsvTest : public ::testing::Test {
+ protected:
+  void SetUp() override { Abc_Start(); }
+  void TearDown() override { Abc_Stop(); }
+};
+
+static std::vector<int> CutLeaves(const Lsv_Cut_t& Cut) {
+  return std::vector<int>(Cut.pLeaves, Cut.pLeaves + Cut.nLeaves);
+}
+
+static Abc_Ntk_t* ReadAig(const char* pFileName) {
+  Abc_Ntk_t* pNtkLogic = Io_Read((char*)pFileName, IO_FILE_BLIF, 1, 0);
+  if (pNtkLogic == nullptr) return nullptr;
+  Abc_Ntk_t* pNtk = Abc_NtkStrash(pNtkLogic, 0, 1, 0);
+  Abc_NtkDelete(pNtkLogic);
+  return pNtk;
+}
+
+TEST_F(LsvTest, PrintsSharedCutsOfExample) {
+  Abc_Ntk_t* pNtk = ReadAig("example.blif");
+  ASSERT_TRUE(pNtk != nullptr);
+  Lsv_MoCutPar_t Pars;
+  Lsv_MoCutSetDefaultPars(&Pars);
+  Lsv_MoCuts_t MoCuts;
+  Lsv_NtkComputeMoCuts(pNtk, &Pars, &MoCuts);
+
+  ASSERT_EQ(Lsv_MoCutsNum(&MoCuts), 2);
+  EXPECT_EQ(CutLeaves(MoCuts.vCuts[0]), std::vector<int>({1, 2}));
+  EXPECT_EQ(Lsv_MoCutsOutNum(&MoCuts, 0), 3);
+  EXPECT_EQ(CutLeaves(MoCuts.vCuts[1]), std::vector<int>({1, 2, 3}));
+  EXPECT_EQ(Lsv_MoCutsOutNum(&MoCuts, 1), 2);
+  Abc_NtkDelete(pNtk);
+}
+
+TEST_F(LsvTest, ParallelEnumerationMatchesSerial) {
+  Abc_Ntk_t* pNtk = ReadAig("benchmarks/router.blif");
+  ASSERT_TRUE(pNtk != nullptr);
+  Lsv_MoCutPar_t Pars;
+  Lsv_MoCutSetDefaultPars(&Pars);
+  Pars.nCutSize = 4;
+  Lsv_MoCuts_t Serial, Parallel;
+  Lsv_NtkComputeMoCuts(pNtk, &Pars, &Serial);
+  Pars.nThreads = 4;
+  Lsv_NtkComputeMoCuts(pNtk, &Pars, &Parallel);
+
+  ASSERT_GT(Lsv_MoCutsNum(&Serial), 0);
+  ASSERT_EQ(Lsv_MoCutsNum(&Serial), Lsv_MoCutsNum(&Parallel));
+  for (int i = 0; i < Lsv_MoCutsNum(&Serial); i++)
+    EXPECT_EQ(CutLeaves(Serial.vCuts[i]), CutLeaves(Parallel.vCuts[i]));
+  EXPECT_EQ(Serial.vOutBeg, Parallel.vOutBeg);
+  EXPECT_EQ(Serial.vOuts, Parallel.vOuts);
+  Abc_NtkDelete(pNtk);
+}
+
+TEST_F(LsvTest, StreamingMatchesInMemory) {
+  Abc_Ntk_t* pNtk = ReadAig("benchmarks/router.blif");
+  ASSERT_TRUE(pNtk != nullptr);
+  Lsv_MoCutPar_t Pars;
+  Lsv_MoCutSetDefaultPars(&Pars);
+  Pars.nCutSize = 4;
+  Lsv_MoCuts_t MoCuts;
+  Lsv_NtkComputeMoCuts(pNtk, &Pars, &MoCuts);
+  std::string Expected;
+  for (int i = 0; i < Lsv_MoCutsNum(&MoCuts); i++) {
+    for (int Leaf : CutLeaves(MoCuts.vCuts[i])) Expected += std::to_string(Leaf) + " ";
+    Expected += ":";
+    for (int k = 0; k < Lsv_MoCutsOutNum(&MoCuts, i); k++)
+      Expected += " " + std::to_string(Lsv_MoCutsOuts(&MoCuts, i)[k]);
+    Expected += "\n";
+  }
+
+  FILE* pFile = tmpfile();
+  ASSERT_TRUE(pFile != nullptr);
+  Pars.nThreads = 2;
+  Pars.nStreamMem = 1;
+  EXPECT_EQ(Lsv_NtkStreamMoCuts(pNtk, &Pars, pFile), 0);
+  std::string Streamed;
+  char Buffer[256];
+  rewind(pFile);
+  while (fgets(Buffer, sizeof(Buffer), pFile)) Streamed += Buffer;
+  fclose(pFile);
+
+  EXPECT_EQ(Streamed, Expected);
+  Abc_NtkDelete(pNtk);
+}
+
+TEST_F(LsvTest, GiaEnumerationMapsBackToNetwork) {
+  Abc_Ntk_t* pNtk = ReadAig("benchmarks/router.blif");
+  ASSERT_TRUE(pNtk != nullptr);
+  Lsv_MoCutPar_t Pars;
+  Lsv_MoCutSetDefaultPars(&Pars);
+  Pars.nCutSize = 4;
+  Pars.fTruth = 1;
+  Lsv_MoCuts_t Expected, MoCuts;
+  Lsv_NtkComputeMoCuts(pNtk, &Pars, &Expected);
+  Vec_Int_t* vMap;
+  Gia_Man_t* pGia = Lsv_NtkToGia(pNtk, &vMap);
+  ASSERT_TRUE(Lsv_GiaCheckAig(pGia));
+  Lsv_GiaComputeMoCuts(pGia, &Pars, vMap, &MoCuts);
+
+  ASSERT_EQ(Lsv_MoCutsNum(&Expected), Lsv_MoCutsNum(&MoCuts));
+  for (int i = 0; i < Lsv_MoCutsNum(&Expected); i++)
+    EXPECT_EQ(CutLeaves(Expected.vCuts[i]), CutLeaves(MoCuts.vCuts[i]));
+  EXPECT_EQ(Expected.vOutBeg, MoCuts.vOutBeg);
+  EXPECT_EQ(Expected.vOuts, MoCuts.vOuts);
+  EXPECT_EQ(Expected.vTruths, MoCuts.vTruths);
+  Gia_ManStop(pGia);
+  Vec_IntFree(vMap);
+  Abc_NtkDelete(pNtk);
+}
+
+TEST_F(LsvTest, ComputesOutputFunctionsAndClasses) {
+  Abc_Ntk_t* pNtk = ReadAig("example.blif");
+  ASSERT_TRUE(pNtk != nullptr);
+  Lsv_MoCutPar_t Pars;
+  Lsv_MoCutSetDefaultPars(&Pars);
+  Pars.fTruth = 1;
+  Lsv_MoCuts_t MoCuts;
+  Lsv_NtkComputeMoCuts(pNtk, &Pars, &MoCuts);
+
+  ASSERT_EQ(Lsv_MoCutsNum(&MoCuts), 2);
+  // 1 2 : 8 9 10 computes ab, ab' and a'b
+  EXPECT_EQ(Lsv_MoCutsTruths(&MoCuts, 0)[0] & 0xF, 0x8u);
+  EXPECT_EQ(Lsv_MoCutsTruths(&MoCuts, 0)[1] & 0xF, 0x2u);
+  EXPECT_EQ(Lsv_MoCutsTruths(&MoCuts, 0)[2] & 0xF, 0x4u);
+  // 1 2 3 : 11 13 computes a'bc' and a'bc
+  EXPECT_EQ(Lsv_MoCutsTruths(&MoCuts, 1)[0] & 0xFF, 0x04u);
+  EXPECT_EQ(Lsv_MoCutsTruths(&MoCuts, 1)[1] & 0xFF, 0x40u);
+  int nFuncs;
+  EXPECT_EQ(Lsv_MoCutsClassify(&MoCuts, &nFuncs), 2);
+  EXPECT_EQ(nFuncs, 2);
+  Abc_NtkDelete(pNtk);
+}
+
+TEST_F(LsvTest, BenchReportsEveryMode) {
+  Lsv_MoCutPar_t Pars;
+  Lsv_MoCutSetDefaultPars(&Pars);
+  std::vector<Lsv_BenchRow_t> vRows;
+  ASSERT_EQ(Lsv_BenchRun((char*)"example.blif", &Pars, 1, &vRows), 0);
+
+  ASSERT_EQ(vRows.size(), 3u);
+  for (const Lsv_BenchRow_t& Row : vRows) {
+    EXPECT_EQ(Row.Name, "example.blif");
+    EXPECT_EQ(Row.nMoCuts, 2);
+    EXPECT_EQ(Row.nCuts, vRows[0].nCuts);
+  }
+  EXPECT_EQ(Lsv_BenchCompare(vRows, vRows, 0), 0);
+  std::vector<Lsv_BenchRow_t> vBase = vRows;
+  vBase[1].nMoCuts++;
+  EXPECT_EQ(Lsv_BenchCompare(vRows, vBase, 0), 1);
+}
+
+ABC_NAMESPACE_IMPL_END
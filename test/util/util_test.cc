@@ -0,0 +1,64 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "misc/util/abc_global.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+static unsigned RandomWord(unsigned& Seed) {
+  Seed = Seed * 1103515245 + 12345;
+  unsigned Hi = Seed >> 16;
+  Seed = Seed * 1103515245 + 12345;
+  return (Hi << 16) | (Seed >> 16);
+}
+
+// runs the SIMD operations at every level supported by the CPU and compares them with the scalar code
+TEST(UtilTest, SimdTruthTableKernelsMatchScalar) {
+  const unsigned Masks[2] = {0, ~0u};
+  int LevelMax = Abc_TtSimdLevel();
+  int LimitOld = Abc_TtSimdSetLimit(0);
+  unsigned Seed = 1;
+  for (int nWords = 0; nWords <= 70; nWords++) {
+    std::vector<unsigned> In0(nWords), In1(nWords), In2(nWords), Care(nWords, 0);
+    for (int w = 0; w < nWords; w++)
+      In0[w] = RandomWord(Seed), In1[w] = RandomWord(Seed), In2[w] = RandomWord(Seed);
+    // the care set has one bit, so that both results of the check occur, including in the tail
+    for (int iCare = -1; iCare < nWords; iCare += (nWords > 20 ? 7 : 1)) {
+      std::fill(Care.begin(), Care.end(), 0);
+      if (iCare >= 0)
+        Care[iCare] = 1u << (RandomWord(Seed) % 32);
+      for (int m = 0; m < 16; m++) {
+        unsigned Mask0 = Masks[m & 1], Mask1 = Masks[(m >> 1) & 1];
+        unsigned MaskF = Masks[(m >> 2) & 1], Mask2 = Masks[(m >> 3) & 1];
+        std::vector<std::vector<unsigned>> Outs;
+        std::vector<int> Results;
+        for (int Level = 0; Level <= LevelMax; Level++) {
+          Abc_TtSimdSetLimit(Level);
+          std::vector<unsigned> Out(nWords + 1, 0xDEADBEEF);
+          Abc_TtAndMasked(Out.data(), In0.data(), In1.data(), Mask0, Mask1, nWords);
+          Outs.push_back(Out);
+          Results.push_back(Abc_TtAndMaskedIsZero(In0.data(), In1.data(), In2.data(), Care.data(), Mask0, Mask1, MaskF, Mask2, nWords));
+        }
+        for (int Level = 1; Level <= LevelMax; Level++) {
+          EXPECT_EQ(Outs[Level], Outs[0]) << "level " << Level << ", words " << nWords << ", masks " << m;
+          EXPECT_EQ(Results[Level], Results[0]) << "level " << Level << ", words " << nWords << ", masks " << m << ", care " << iCare;
+        }
+        // the scalar code is checked against the definition
+        int Result = 1;
+        for (int w = 0; w < nWords; w++) {
+          EXPECT_EQ(Outs[0][w], (In0[w] ^ Mask0) & (In1[w] ^ Mask1));
+          if (((((In0[w] ^ Mask0) & (In1[w] ^ Mask1)) ^ MaskF) & (In2[w] ^ Mask2) & Care[w]) != 0)
+            Result = 0;
+        }
+        EXPECT_EQ(Outs[0][nWords], 0xDEADBEEF);
+        EXPECT_EQ(Results[0], Result);
+      }
+    }
+  }
+  Abc_TtSimdSetLimit(LimitOld);
+}
+
+ABC_NAMESPACE_IMPL_END